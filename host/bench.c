@@ -0,0 +1,245 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bench.c
+ **
+ ** @brief Mediciones de rendimiento en el host de los caminos criticos
+ **
+ ** Ejecuta repetidamente las funciones que se llaman desde la interrupcion del
+ ** SysTick o desde el lazo principal y reporta, en formato CSV, el tiempo medio por
+ ** llamada y la cantidad de escrituras a registros de perifericos modeladas por
+ ** chip.h. Cada caso se mide varias veces y se informa la mejor corrida.
+ ** 
+ ** Uso: bench [iteraciones]
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup host Compilacion en el host
+ ** @brief Mediciones de rendimiento en el host
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "chip.h"
+#include "bsp.h"
+#include "clock.h"
+#include "screen.h"
+#include "digital.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Cantidad de corridas de cada caso, se informa la mas rapida
+#define BENCH_RUNS 5
+
+#define BENCH_DEFAULT_ITERATIONS 1000000
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+typedef void (*bench_function_t)(void);
+
+typedef struct bench_s {
+    const char * name;
+    bench_function_t setup;
+    bench_function_t function;
+} const * bench_t;
+
+/* === Definiciones de variables privadas ================================== */
+
+static board_t board;
+
+static clock_t reloj;
+
+static uint8_t digits[] = {1, 2, 3, 4};
+
+static const uint8_t ULTIMO_SEGUNDO[] = {2, 3, 5, 9, 5, 9};
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static void AlarmEvent(clock_t clock, bool state);
+
+static void ClockNormalSetup(void);
+
+static void ClockRolloverSetup(void);
+
+static void ClockTick(void);
+
+static void ClockSetupLastSecond(void);
+
+static void ClockRollover(void);
+
+static void Refresh(void);
+
+static void WriteBCD(void);
+
+static void WriteNumber(void);
+
+static void WriteTime(void);
+
+static void ToggleDots(void);
+
+static void HasActivated(void);
+
+static double Measure(bench_t bench, uint32_t iterations, double * writes);
+
+/* === Definiciones de funciones privadas ================================== */
+
+static void AlarmEvent(clock_t clock, bool state){
+    (void) clock;
+    (void) state;
+}
+
+// Con la maxima cantidad de ticks por segundo el segundo casi nunca se completa
+static void ClockNormalSetup(void){
+    reloj = ClockCreate(UINT16_MAX, AlarmEvent);
+    ClockSetupTime(reloj, ULTIMO_SEGUNDO, sizeof(ULTIMO_SEGUNDO));
+}
+
+// Con un tick por segundo cada llamada completa un segundo
+static void ClockRolloverSetup(void){
+    reloj = ClockCreate(1, AlarmEvent);
+}
+
+static void ClockTick(void){
+    ClockNewTick(reloj);
+}
+
+static void ClockSetupLastSecond(void){
+    ClockSetupTime(reloj, ULTIMO_SEGUNDO, sizeof(ULTIMO_SEGUNDO));
+}
+
+// Cada llamada pasa de 23:59:59 a 00:00:00, el costo de la puesta en hora se descuenta aparte
+static void ClockRollover(void){
+    ClockSetupTime(reloj, ULTIMO_SEGUNDO, sizeof(ULTIMO_SEGUNDO));
+    ClockNewTick(reloj);
+}
+
+static void Refresh(void){
+    DisplayRefresh(board->display);
+}
+
+static void WriteBCD(void){
+    DisplayWriteBCD(board->display, digits, sizeof(digits));
+}
+
+static void WriteNumber(void){
+    DisplayWriteNumber(board->display, 1234);
+}
+
+static void WriteTime(void){
+    DisplayWriteTime(board->display, 12, 34);
+}
+
+static void ToggleDots(void){
+    DisplayToggleDots(board->display, 0, 3);
+}
+
+static void HasActivated(void){
+    DigitalInputHasActivated(board->accept);
+}
+
+static double Measure(bench_t bench, uint32_t iterations, double * writes){
+    double best = 0;
+
+    for (int run = 0; run < BENCH_RUNS; run++){
+        uint64_t start;
+        uint32_t registers;
+        double elapsed;
+
+        if (bench->setup) bench->setup();
+        registers = HostRegisterWrites;
+        start = HostNanoseconds();
+        for (uint32_t index = 0; index < iterations; index++){
+            bench->function();
+        }
+        elapsed = HostNanoseconds() - start;
+
+        if ((run == 0) || (elapsed < best)) best = elapsed;
+        *writes = (double)(HostRegisterWrites - registers) / iterations;
+    }
+    return best / iterations;
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+int main(int argc, char * argv[]){
+    static const struct bench_s BENCHS[] = {
+        {"ClockNewTick", ClockNormalSetup, ClockTick},
+        {"ClockSetupTime", ClockRolloverSetup, ClockSetupLastSecond},
+        {"ClockNewTick_rollover", ClockRolloverSetup, ClockRollover},
+        {"DisplayRefresh", NULL, Refresh},
+        {"DisplayWriteBCD", NULL, WriteBCD},
+        {"DisplayWriteNumber", NULL, WriteNumber},
+        {"DisplayWriteTime", NULL, WriteTime},
+        {"DisplayToggleDots", NULL, ToggleDots},
+        {"DigitalInputHasActivated", NULL, HasActivated},
+    };
+    uint32_t iterations = (argc > 1) ? strtoul(argv[1], NULL, 0) : BENCH_DEFAULT_ITERATIONS;
+    double setup = 0;
+
+    if (iterations == 0){
+        fprintf(stderr, "Uso: %s [iteraciones]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    board = BoardCreate();
+
+    printf("name,iterations,ns_per_op,register_writes_per_op\n");
+    for (unsigned index = 0; index < sizeof(BENCHS) / sizeof(BENCHS[0]); index++){
+        bench_t bench = &BENCHS[index];
+        double writes;
+        double time = Measure(bench, iterations, &writes);
+
+        if (bench->function == ClockSetupLastSecond){
+            // Solo se mide para descontarlo del caso de desborde, no se informa
+            setup = time;
+            continue;
+        }
+        if (bench->function == ClockRollover){
+            time = (time > setup) ? time - setup : 0;
+        }
+        printf("%s,%u,%.3f,%.3f\n", bench->name, iterations, time, writes);
+    }
+    return EXIT_SUCCESS;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
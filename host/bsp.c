@@ -0,0 +1,253 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bsp.c
+ **
+ ** @brief Placa simulada para la compilacion en el host
+ **
+ ** Implementacion de BoardCreate para el host. Usa los mismos puertos y bits que
+ ** la placa real sobre el modelo de GPIO de chip.h, la SCU solo cuenta escrituras, para que
+ ** las herramientas del host ejecuten los modulos del firmware sin cambios.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup host Compilacion en el host
+ ** @brief Placa simulada para el host
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "chip.h"
+#include "bsp.h"
+#include "poncho.h"
+#include "max7219.h"
+#include "pin.h"
+#include "serial.h"
+#include <stdio.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Con MAX7219_DISPLAY_DIGITS la pantalla es el controlador modelado en chip.c, como en la placa
+#ifdef MAX7219_DISPLAY_DIGITS
+    #if (MAX7219_DISPLAY_DIGITS > MAX7219_DIGITS)
+        #error "Un controlador MAX7219 maneja hasta ocho digitos"
+    #endif
+#endif
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+static struct board_s board = {0};
+
+/* === Declaraciones de funciones privadas ================================= */
+
+#ifdef MAX7219_DISPLAY_DIGITS
+static void ControllerClear(void);
+static void ControllerWrite(uint8_t const * segments, uint8_t digits);
+static void ControllerBrightness(uint8_t level);
+#else
+static void clearScreen(void);
+static void WriteNumber(uint8_t segments);
+static void SelectDigit(uint8_t digit);
+#endif
+static void BuzzerToneSet(uint16_t frequency, uint8_t volume);
+static void SerialStart(uint8_t * buffer, uint16_t size);
+static uint16_t SerialReceived(void);
+static void SerialSend(uint8_t const * data, uint16_t size);
+static bool SerialSending(void);
+static void LightStart(uint32_t * buffer, uint16_t size);
+static uint16_t LightValue(uint32_t sample);
+
+/* === Definiciones de variables privadas ================================== */
+
+#ifdef MAX7219_DISPLAY_DIGITS
+// Controlador de la pantalla, con la copia de sus registros de digito
+static max7219_t controller;
+#endif
+
+// Buffer de recepcion circular que en la placa llena el DMA
+static struct {
+    uint8_t * buffer;
+    uint16_t size;
+    uint16_t head;
+} serial;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Definiciones de funciones privadas ================================== */
+
+#ifndef MAX7219_DISPLAY_DIGITS
+void clearScreen(void){
+    Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
+    Chip_GPIO_ClearValue(LPC_GPIO_PORT, SEGMENTS_GPIO, SEGMENTS_MASK);
+    PIN_DEACTIVATE(SEGMENT_P);
+}
+
+void WriteNumber(uint8_t segments){
+    Chip_GPIO_SetValue(LPC_GPIO_PORT, SEGMENTS_GPIO, (segments)&SEGMENTS_MASK);
+    PIN_WRITE(SEGMENT_P, (segments & SEGMENT_P) != 0);
+}
+
+void SelectDigit(uint8_t digit){
+    Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, (1 << ( 3 - digit)) & DIGITS_MASK );
+}
+#else
+void ControllerClear(void){
+    Max7219Clear(controller);
+}
+
+void ControllerWrite(uint8_t const * segments, uint8_t digits){
+    Max7219Write(controller, segments, digits);
+}
+
+void ControllerBrightness(uint8_t level){
+    Max7219SetBrightness(controller, level);
+}
+#endif
+
+// Registra cada cambio de tono con el tiempo simulado y refleja en el terminal si el zumbador suena
+void BuzzerToneSet(uint16_t frequency, uint8_t volume){
+    unsigned long long now = HostCycles / (SystemCoreClock / 1000);
+
+    HostPinSet(BUZZER_GPIO, BUZZER_BIT, frequency && volume);
+    if (frequency && volume){
+        fprintf(stderr, "zumbador %10llu ms: %u Hz, volumen %u%%\n", now, frequency, volume);
+    } else {
+        fprintf(stderr, "zumbador %10llu ms: silencio\n", now);
+    }
+}
+
+void SerialStart(uint8_t * buffer, uint16_t size){
+    serial.buffer = buffer;
+    serial.size = size;
+    serial.head = 0;
+    HostSerialOpen();
+}
+
+// Copia lo recibido por la pseudo terminal en el buffer circular, como lo haria el DMA
+uint16_t SerialReceived(void){
+    uint16_t count;
+
+    do {
+        count = HostSerialRead(&serial.buffer[serial.head], serial.size - serial.head);
+        serial.head = (serial.head + count) % serial.size;
+    } while (count > 0);
+    return serial.head;
+}
+
+void SerialSend(uint8_t const * data, uint16_t size){
+    HostSerialWrite(data, size);
+}
+
+bool SerialSending(void){
+    return false;
+}
+
+// Las conversiones las entrega la herramienta con HostAdcSample, por ejemplo leidas de un archivo
+void LightStart(uint32_t * buffer, uint16_t size){
+    HostAdc.buffer = buffer;
+    HostAdc.size = size;
+    HostAdc.position = 0;
+}
+
+uint16_t LightValue(uint32_t sample){
+    return ADC_DR_DONE(sample) ? ADC_DR_RESULT(sample) : AMBIENT_NO_SAMPLE;
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+board_t BoardCreate(void){
+#ifdef MAX7219_DISPLAY_DIGITS
+    static const struct display_driver_s display_driver = {
+        .ScreenTurnOff = ControllerClear,
+        .WriteFrame = ControllerWrite,
+        .SetBrightness = ControllerBrightness,
+    };
+#else
+    static const struct display_driver_s display_driver = {
+        .ScreenTurnOff = clearScreen,
+        .ScreenTurnOn = WriteNumber,
+        .DigitTurnOn = SelectDigit,
+    };
+#endif
+    static const struct buzzer_driver_s buzzer_driver = {
+        .ToneSet = BuzzerToneSet,
+    };
+    static const struct serial_driver_s serial_driver = {
+        .Start = SerialStart,
+        .Received = SerialReceived,
+        .Send = SerialSend,
+        .Sending = SerialSending,
+    };
+    static const struct light_driver_s light_driver = {
+        .Start = LightStart,
+        .Value = LightValue,
+        .full_scale = 1023,
+    };
+
+    PinsInit();
+
+    board.buzzer = BuzzerCreate(&buzzer_driver);
+
+    board.setTime = DigitalInputCreate(TEC_F1_GPIO, TEC_F1_BIT, false);
+    board.setAlarm = DigitalInputCreate(TEC_F2_GPIO, TEC_F2_BIT, false);
+    board.increment = DigitalInputCreate(TEC_F3_GPIO, TEC_F3_BIT, false);
+    board.decrement = DigitalInputCreate(TEC_F4_GPIO, TEC_F4_BIT, false);
+    board.accept = DigitalInputCreate(TEC_ACCEPT_GPIO, TEC_ACCEPT_BIT, false);
+    board.cancel = DigitalInputCreate(TEC_CANCEL_GPIO, TEC_CANCEL_BIT, false);
+    board.pps = DigitalInputCreate(PPS_GPIO, PPS_BIT, false);
+
+    board.ledRed = DigitalOutputCreate(LED_R_GPIO, LED_R_BIT);
+    board.ledGreen = DigitalOutputCreate(LED_G_GPIO, LED_G_BIT);
+    board.ledBlue = DigitalOutputCreate(LED_B_GPIO, LED_B_BIT);
+    board.ledRojo = DigitalOutputCreate(LED_1_GPIO, LED_1_BIT);
+    board.ledAmar = DigitalOutputCreate(LED_2_GPIO, LED_2_BIT);
+    board.ledVerde = DigitalOutputCreate(LED_3_GPIO, LED_3_BIT);
+
+#ifdef MAX7219_DISPLAY_DIGITS
+    controller = Max7219Create(MAX7219_DISPLAY_DIGITS, HostControllerSend);
+    board.display = DisplayCreate(MAX7219_DISPLAY_DIGITS, &display_driver);
+#else
+    board.display = DisplayCreate(4, &display_driver);
+#endif
+    board.serial = &serial_driver;
+    board.light = &light_driver;
+    return &board;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,277 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file chain.c
+ **
+ ** @brief Barrido y atenuacion de una pantalla en una cadena de registros de desplazamiento
+ **
+ ** Maneja la cadena de shift.c sobre los registros modelados en chip.c, que como en la
+ ** placa cargan en las salidas la cadena del paso anterior y se apagan en el acto con la
+ ** habilitacion. Primero verifica, para varias cantidades de digitos, que la frecuencia
+ ** de DisplayScanRate encienda cada digito al menos DISPLAY_DIGIT_RATE veces por segundo
+ ** con sus segmentos, tambien cuando un envio dura mas que un turno y hay que saltear
+ ** pasos del barrido sin cargar cadenas a medio desplazar. Despues, para cada largo de
+ ** turno y cada nivel de brillo, cuenta las llamadas a DisplayDimTick con el digito
+ ** encendido y las compara con la fraccion del turno que corresponde al nivel.
+ **
+ ** Uso: chain [llamadas por turno]
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.09.03 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup host Compilacion en el host
+ ** @brief Barrido de la cadena de registros
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "app.h"
+#include "chip.h"
+#include "screen.h"
+#include "shift.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Sin argumentos se recorren todos los largos de turno hasta este, con cuatro digitos el turno dura cinco ticks
+#define CHAIN_MAX_SLOT 16
+
+#define CHAIN_DIMMING_DIGITS 4
+
+// Turnos medidos por nivel y turnos iniciales que se descartan mientras se mide el largo del turno
+#define CHAIN_TURNS 64
+
+#define CHAIN_WARMUP 2
+
+// Duracion en ticks de un envio lento, mayor que el turno de las cadenas largas
+#define CHAIN_SLOW_TRANSFER 3
+
+#define ELEMENTS(array) (sizeof(array) / sizeof(array[0]))
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+/* === Definiciones de variables privadas ================================== */
+
+// Cantidades de digitos en las que se verifica el barrido
+static const uint8_t DIGITS[] = {4, 8, 16, SHIFT_MAX_DIGITS};
+
+static shift_t cadena;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static void ChainClear(void);
+
+static bool ChainScan(uint8_t digit, uint8_t segments);
+
+static display_t ChainCreate(uint8_t digits);
+
+static int ChainLitDigit(uint8_t digits);
+
+static uint32_t CheckScan(uint8_t digits, uint16_t transfer);
+
+static uint32_t CheckSlot(uint8_t slot);
+
+/* === Definiciones de funciones privadas ================================== */
+
+void ChainClear(void){
+    ShiftBlank(cadena);
+}
+
+bool ChainScan(uint8_t digit, uint8_t segments){
+    return ShiftScan(cadena, digit, segments);
+}
+
+// Crea la cadena y la pantalla, con el numero de cada digito en su posicion
+display_t ChainCreate(uint8_t digits){
+    static const struct shift_driver_s shift_driver = {
+        .Send = HostShiftSend,
+        .Latch = HostShiftLatch,
+        .Blank = HostShiftBlank,
+        .Busy = HostShiftBusy,
+    };
+    static const struct display_driver_s driver = {
+        .ScreenTurnOff = ChainClear,
+        .ScanDigit = ChainScan,
+    };
+    uint8_t number[SHIFT_MAX_DIGITS];
+    display_t display;
+
+    cadena = ShiftCreate(digits, &shift_driver);
+    display = DisplayCreate(digits, &driver);
+    for (uint8_t digit = 0; digit < digits; digit++){
+        number[digit] = digit % 10;
+    }
+    DisplayWriteBCD(display, number, digits);
+    DisplayCommit(display);
+    return display;
+}
+
+// Digito que muestran las salidas, -1 si estan apagadas o sin digito y -2 si hay mas de uno
+int ChainLitDigit(uint8_t digits){
+    uint8_t size = SHIFT_CHAIN_SIZE(digits);
+    int lit = -1;
+
+    if (HostShift.blank) return -1;
+    for (uint8_t digit = 0; digit < digits; digit++){
+        if (HostShift.outputs[size - 2 - digit / 8] & (1 << (digit % 8))){
+            if (lit >= 0) return -2;
+            lit = digit;
+        }
+    }
+    return lit;
+}
+
+// Recorre un segundo de barrido y devuelve la cantidad de problemas encontrados
+uint32_t CheckScan(uint8_t digits, uint16_t transfer){
+    uint8_t segments[SHIFT_MAX_DIGITS];
+    uint16_t shown[SHIFT_MAX_DIGITS] = {0};
+    uint32_t errors = 0;
+    uint16_t rate, slot, least;
+    uint32_t sends;
+    display_t display;
+
+    HostShift.transfer = transfer;
+    display = ChainCreate(digits);
+    DisplayReadFrame(display, segments, digits);
+    rate = DisplayScanRate(display, APP_TICKS_PER_SECOND);
+    slot = APP_TICKS_PER_SECOND / rate;
+    if ((APP_TICKS_PER_SECOND % rate) || ((rate < digits * DISPLAY_DIGIT_RATE) && (slot > 1))) errors++;
+
+    HostShift.torn = 0;
+    sends = HostShift.sends;
+    /* Como en app.c el refresco y la atenuacion del mismo tick se llaman en ese orden, la primera
+       vuelta del barrido solo llena la cadena y no se cuenta */
+    for (uint32_t tick = 0; tick < (uint32_t) digits * slot + APP_TICKS_PER_SECOND; tick++){
+        HostShiftTick();
+        if (tick % slot == 0) DisplayRefresh(display);
+        DisplayDimTick(display);
+        if ((tick % slot == 0) && (tick >= (uint32_t) digits * slot)){
+            int lit = ChainLitDigit(digits);
+
+            if (lit == -2){
+                errors++;
+            } else if (lit >= 0){
+                shown[lit]++;
+                if (HostShift.outputs[SHIFT_CHAIN_SIZE(digits) - 1] != segments[lit]) errors++;
+            }
+        }
+    }
+    sends = HostShift.sends - sends;
+    errors += HostShift.torn;
+
+    least = shown[0];
+    for (uint8_t digit = 1; digit < digits; digit++){
+        if (shown[digit] < least) least = shown[digit];
+    }
+    /* Con los envios a tiempo cada digito se enciende una vez por vuelta del barrido, con envios lentos
+       el reintento no debe dejar ningun digito sin encender */
+    if ((transfer == 0) && (least < rate / digits)) errors++;
+    if (least == 0) errors++;
+
+    printf("%u,%u,%u,%u,%lu,%lu,%lu\n", digits, transfer, rate, least, (unsigned long) sends,
+        (unsigned long) HostShift.torn, (unsigned long) errors);
+    HostShift.transfer = 0;
+    return errors;
+}
+
+// Devuelve la cantidad de niveles cuyo tiempo encendido no coincide con el esperado
+uint32_t CheckSlot(uint8_t slot){
+    uint32_t mismatches = 0;
+
+    printf("%u", slot);
+    for (uint8_t level = 0; level < DISPLAY_BRIGHTNESS_LEVELS; level++){
+        display_t display = ChainCreate(CHAIN_DIMMING_DIGITS);
+        uint32_t expected = ((level + 1) * slot + DISPLAY_BRIGHTNESS_LEVELS - 1) / DISPLAY_BRIGHTNESS_LEVELS;
+        uint32_t lit = 0;
+
+        DisplaySetBrightness(display, level);
+        for (uint32_t tick = 0; tick < (CHAIN_WARMUP + CHAIN_TURNS) * slot; tick++){
+            if (tick % slot == 0) DisplayRefresh(display);
+            DisplayDimTick(display);
+            if ((tick >= CHAIN_WARMUP * slot) && (ChainLitDigit(CHAIN_DIMMING_DIGITS) >= 0)) lit++;
+        }
+        printf(",%lu", (unsigned long) lit);
+        if (lit != expected * CHAIN_TURNS){
+            mismatches++;
+        }
+    }
+    printf("\n");
+    return mismatches;
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+int main(int argc, char * argv[]){
+    uint8_t first = 1;
+    uint8_t last = CHAIN_MAX_SLOT;
+    uint32_t errors = 0;
+    uint32_t mismatches = 0;
+
+    if (argc > 1){
+        first = last = strtoul(argv[1], NULL, 0);
+        if (first == 0){
+            fprintf(stderr, "Uso: %s [llamadas por turno]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf("digitos,envio,barrido,minimo_por_digito,envios,mezclas,errores\n");
+    for (uint8_t index = 0; index < ELEMENTS(DIGITS); index++){
+        errors += CheckScan(DIGITS[index], 0);
+        errors += CheckScan(DIGITS[index], CHAIN_SLOW_TRANSFER);
+    }
+    printf("barrido en un segundo, %lu errores\n\n", (unsigned long) errors);
+
+    printf("turno");
+    for (uint8_t level = 0; level < DISPLAY_BRIGHTNESS_LEVELS; level++){
+        printf(",nivel_%u", level);
+    }
+    printf("\n");
+    for (uint8_t slot = first; slot <= last; slot++){
+        mismatches += CheckSlot(slot);
+    }
+    printf("llamadas encendido por cada %u turnos, %lu niveles distintos del esperado\n", CHAIN_TURNS,
+        (unsigned long) mismatches);
+    return (errors || mismatches) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
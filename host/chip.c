@@ -0,0 +1,147 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file chip.c
+ **
+ ** @brief Reemplazo en el host de la biblioteca LPCOpen
+ **
+ ** Estado de los perifericos modelados en el host.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup host Compilacion en el host
+ ** @brief Reemplazo de la biblioteca del fabricante para el host
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "chip.h"
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+/* === Definiciones de variables privadas ================================== */
+
+/* === Definiciones de variables publicas ================================== */
+
+LPC_GPIO_T HostGpio = {0};
+DWT_Type HostDwt = {0};
+CoreDebug_Type HostCoreDebug = {0};
+
+uint32_t SystemCoreClock = 204000000;
+uint32_t HostSysTickRate = 0;
+uint32_t HostRegisterWrites = 0;
+uint64_t HostCycles = 0;
+HOST_CONTROLLER_T HostController = {0};
+
+HOST_SHIFT_T HostShift = {0};
+
+HOST_ADC_T HostAdc = {0};
+
+/* === Declaraciones de funciones privadas ================================= */
+
+/* === Definiciones de funciones privadas ================================== */
+
+/* === Definiciones de funciones publicas ================================== */
+
+uint64_t HostNanoseconds(void){
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+void HostControllerSend(uint16_t const * words, uint8_t count){
+    for (uint8_t index = 0; index < count; index++){
+        HostController.registers[(words[index] >> 8) & 0x0F] = words[index] & 0xFF;
+        HostController.words++;
+        HostRegisterWrites++;
+    }
+    if (count){
+        HostController.bursts++;
+    }
+}
+
+void HostAdcSample(uint16_t value){
+    if (HostAdc.buffer == NULL) return;
+    HostAdc.buffer[HostAdc.position] = (1UL << 31) | ((uint32_t) (value & 0x3FF) << 6);
+    HostAdc.position = (HostAdc.position + 1) % HostAdc.size;
+    HostAdc.samples++;
+}
+
+void HostShiftSend(uint8_t const * chain, uint8_t size){
+    if (HostShift.pending) HostShift.torn++;
+    HostShift.size = (size < HOST_SHIFT_BYTES) ? size : HOST_SHIFT_BYTES;
+    memcpy(HostShift.incoming, chain, HostShift.size);
+    HostShift.pending = HostShift.transfer;
+    HostShift.sends++;
+    if (HostShift.pending == 0){
+        memcpy(HostShift.shifted, HostShift.incoming, sizeof(HostShift.shifted));
+    }
+}
+
+// Con un envio en curso los registros tendrian una mezcla de las dos cadenas
+void HostShiftLatch(void){
+    if (HostShift.pending) HostShift.torn++;
+    memcpy(HostShift.outputs, HostShift.shifted, sizeof(HostShift.outputs));
+    HostRegisterWrites++;
+}
+
+void HostShiftBlank(bool blank){
+    HostShift.blank = blank;
+    HostRegisterWrites++;
+}
+
+bool HostShiftBusy(void){
+    return HostShift.pending > 0;
+}
+
+void HostShiftTick(void){
+    if ((HostShift.pending > 0) && (--HostShift.pending == 0)){
+        memcpy(HostShift.shifted, HostShift.incoming, sizeof(HostShift.shifted));
+    }
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
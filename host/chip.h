@@ -0,0 +1,339 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file chip.h
+ **
+ ** @brief Reemplazo en el host de la biblioteca LPCOpen
+ **
+ ** Modelo minimo de los perifericos del LPC4337 que usa el firmware, para compilar
+ ** y ejecutar en el host los modulos que no dependen de la placa. Los puertos de
+ ** GPIO se guardan en los registros de byte B, como en el microcontrolador, y cada
+ ** escritura a un registro modelado incrementa HostRegisterWrites.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup host Compilacion en el host
+ ** @brief Reemplazo de la biblioteca del fabricante para el host
+ ** @{
+ */
+
+#ifndef CHIP_H   /*! @cond    */
+#define CHIP_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+#define __IO volatile
+
+// Cantidad de puertos de GPIO modelados
+#define HOST_GPIO_PORTS 8
+
+// Funciones de la SCU, no tienen efecto en el host
+#define SCU_MODE_INBUFF_EN  (1 << 6)
+#define SCU_MODE_INACT      (1 << 4)
+#define SCU_MODE_PULLUP     (0)
+#define SCU_MODE_ZIF_DIS    (1 << 7)
+#define SCU_MODE_FUNC0      0x0
+#define SCU_MODE_FUNC1      0x1
+#define SCU_MODE_FUNC2      0x2
+#define SCU_MODE_FUNC3      0x3
+#define SCU_MODE_FUNC4      0x4
+#define SCU_MODE_FUNC5      0x5
+#define SCU_MODE_FUNC6      0x6
+#define SCU_MODE_FUNC7      0x7
+
+#define __NVIC_PRIO_BITS 3
+
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+
+// Campos del registro de datos del ADC, con el mismo formato que copia el DMA en la placa
+#define ADC_DR_RESULT(n)    (((n) >> 6) & 0x3FF)
+#define ADC_DR_DONE(n)      ((n) >> 31)
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Registros de GPIO, solo se modelan los registros de byte y de direccion
+typedef struct {
+    __IO uint8_t B[HOST_GPIO_PORTS][32];
+    __IO uint32_t DIR[HOST_GPIO_PORTS];
+} LPC_GPIO_T;
+
+typedef struct {
+    __IO uint32_t CTRL;
+    __IO uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef enum {
+    SysTick_IRQn = -1,
+} IRQn_Type;
+
+/* === Declaraciones de variables publicas ================================= */
+
+extern LPC_GPIO_T HostGpio;
+extern DWT_Type HostDwt;
+extern CoreDebug_Type HostCoreDebug;
+
+// Frecuencia del nucleo que se informa al firmware
+extern uint32_t SystemCoreClock;
+
+// Frecuencia configurada con SysTick_Config, en Hz
+extern uint32_t HostSysTickRate;
+
+// Cantidad de escrituras a registros de perifericos realizadas
+extern uint32_t HostRegisterWrites;
+
+// Ciclos del nucleo transcurridos desde el inicio, sin el desborde de CYCCNT
+extern uint64_t HostCycles;
+
+// Controlador de pantalla modelado, con los registros de un MAX7219 conectado al SSP
+typedef struct {
+    uint8_t registers[16];  //!< Ultimo dato escrito en cada direccion
+    uint32_t words;         //!< Palabras recibidas desde el inicio
+    uint32_t bursts;        //!< Rafagas recibidas desde el inicio
+} HOST_CONTROLLER_T;
+
+extern HOST_CONTROLLER_T HostController;
+
+// Bytes de la cadena de registros modelada, alcanzan para 56 digitos
+#define HOST_SHIFT_BYTES 8
+
+// Cadena de registros 74HC595 modelada, recibe los bytes del SSP por DMA
+typedef struct {
+    uint8_t incoming[HOST_SHIFT_BYTES]; //!< Cadena que se esta desplazando
+    uint8_t shifted[HOST_SHIFT_BYTES];  //!< Contenido de los registros, el ultimo byte enviado es el primero
+    uint8_t outputs[HOST_SHIFT_BYTES];  //!< Salidas, con lo que tenian los registros en la ultima carga
+    uint8_t size;                       //!< Bytes del ultimo envio
+    bool blank;                         //!< Habilitacion de las salidas, en alto las apaga
+    uint16_t transfer;                  //!< Llamadas a HostShiftTick que dura un envio, con cero termina en el acto
+    uint16_t pending;                   //!< Llamadas que faltan para terminar el envio en curso
+    uint32_t sends;                     //!< Envios desde el inicio
+    uint32_t torn;                      //!< Envios y cargas hechos con otro envio en curso
+} HOST_SHIFT_T;
+
+extern HOST_SHIFT_T HostShift;
+
+// Conversor del sensor de luz modelado, escribe cada muestra en el buffer circular como lo haria el DMA
+typedef struct {
+    uint32_t * buffer;      //!< Buffer circular del DMA, nulo mientras no se inicia la conversion
+    uint16_t size;          //!< Cantidad de palabras del buffer
+    uint16_t position;      //!< Posicion en la que se escribe la proxima conversion
+    uint32_t samples;       //!< Conversiones realizadas desde el inicio
+} HOST_ADC_T;
+
+extern HOST_ADC_T HostAdc;
+
+#define LPC_GPIO_PORT (&HostGpio)
+#define DWT (&HostDwt)
+#define CoreDebug (&HostCoreDebug)
+
+// Accesos directos de pin.h, el registro de inversion no se modela y se cuentan las escrituras
+#define PIN_STORE(gpio, bit, state) (HostGpio.B[gpio][bit] = (state), HostRegisterWrites++)
+#define PIN_INVERT(gpio, bit) (HostGpio.B[gpio][bit] = !HostGpio.B[gpio][bit], HostRegisterWrites++)
+
+/* === Declaraciones de funciones publicas ================================= */
+
+static inline void Chip_SCU_PinMuxSet(uint8_t port, uint8_t pin, uint16_t mode){
+    (void) port;
+    (void) pin;
+    (void) mode;
+    HostRegisterWrites++;
+}
+
+static inline void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool setting){
+    gpio->B[port][pin] = setting;
+    HostRegisterWrites++;
+}
+
+static inline void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output){
+    if (output){
+        gpio->DIR[port] |= 1UL << pin;
+    } else {
+        gpio->DIR[port] &= ~(1UL << pin);
+    }
+    HostRegisterWrites++;
+}
+
+static inline void Chip_GPIO_SetPortDIR(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask, bool output){
+    if (output){
+        gpio->DIR[port] |= mask;
+    } else {
+        gpio->DIR[port] &= ~mask;
+    }
+    HostRegisterWrites++;
+}
+
+static inline void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin){
+    gpio->B[port][pin] = !gpio->B[port][pin];
+    HostRegisterWrites++;
+}
+
+static inline bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin){
+    return gpio->B[port][pin];
+}
+
+static inline void Chip_GPIO_SetValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask){
+    while (mask){
+        gpio->B[port][__builtin_ctz(mask)] = 1;
+        mask &= mask - 1;
+    }
+    HostRegisterWrites++;
+}
+
+static inline void Chip_GPIO_ClearValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask){
+    while (mask){
+        gpio->B[port][__builtin_ctz(mask)] = 0;
+        mask &= mask - 1;
+    }
+    HostRegisterWrites++;
+}
+
+static inline void SystemCoreClockUpdate(void){
+}
+
+static inline uint32_t SysTick_Config(uint32_t ticks){
+    HostSysTickRate = SystemCoreClock / ticks;
+    return 0;
+}
+
+static inline void NVIC_SetPriority(IRQn_Type irq, uint32_t priority){
+    (void) irq;
+    (void) priority;
+}
+
+static inline void __disable_irq(void){
+}
+
+static inline void __enable_irq(void){
+}
+
+/**
+ * @brief Tiempo monotono del host, para medir duraciones en las herramientas
+ *
+ * @return uint64_t Nanosegundos desde un origen arbitrario
+ */
+uint64_t HostNanoseconds(void);
+
+/**
+ * @brief Entrega al controlador de pantalla modelado una rafaga de palabras del bus
+ *
+ * @param words Palabras con la direccion del registro en el byte alto y el dato en el bajo
+ * @param count Cantidad de palabras de la rafaga
+ */
+void HostControllerSend(uint16_t const * words, uint8_t count);
+
+/**
+ * @brief Entrega una conversion del sensor de luz, se escribe en el buffer como el registro de datos
+ *
+ * @param value Resultado de la conversion, entre 0 y 1023
+ */
+void HostAdcSample(uint16_t value);
+
+/**
+ * @brief Empieza a enviar una cadena a los registros modelados, como el DMA de la placa
+ *
+ * @param chain Bytes de la cadena, el ultimo queda en el primer registro
+ * @param size  Cantidad de bytes, hasta HOST_SHIFT_BYTES
+ */
+void HostShiftSend(uint8_t const * chain, uint8_t size);
+
+/**
+ * @brief Pasa el contenido de los registros modelados a las salidas
+ */
+void HostShiftLatch(void);
+
+/**
+ * @brief Maneja la habilitacion de las salidas de los registros modelados
+ *
+ * @param blank Con true las salidas se apagan
+ */
+void HostShiftBlank(bool blank);
+
+/**
+ * @brief Consulta si los registros modelados todavia estan recibiendo una cadena
+ *
+ * @return true     Hay un envio en curso
+ * @return false    La ultima cadena ya termino de desplazarse
+ */
+bool HostShiftBusy(void);
+
+/**
+ * @brief Avanza el envio en curso, se llama una vez por tick
+ */
+void HostShiftTick(void);
+
+/**
+ * @brief Fuerza el nivel de un terminal, usado por las herramientas para simular las teclas
+ *
+ * @param port  Puerto de GPIO del terminal
+ * @param pin   Bit del terminal dentro del puerto
+ * @param state Nivel que se lee en el terminal
+ */
+static inline void HostPinSet(uint8_t port, uint8_t pin, bool state){
+    HostGpio.B[port][pin] = state;
+}
+
+/**
+ * @brief Avanza el contador de ciclos modelado
+ *
+ * @param cycles    Ciclos del nucleo que se consideran transcurridos
+ */
+static inline void HostCyclesAdvance(uint32_t cycles){
+    HostDwt.CYCCNT += cycles;
+    HostCycles += cycles;
+}
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* CHIP_H */
@@ -0,0 +1,208 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file commands.c
+ **
+ ** @brief Verificacion de los comandos de la consola sobre la aplicacion completa
+ **
+ ** Ejecuta la logica de la aplicacion sobre la placa simulada del host, con el puerto
+ ** serie reemplazado por una secuencia fija de lineas en lugar de la pseudo terminal.
+ ** Cada linea se envia, se simulan ticks hasta que llega la respuesta y se compara con
+ ** la esperada; algunos pasos ademas dejan correr el tiempo y verifican si el zumbador
+ ** suena. Cubre la alarma con dias de la semana, que solo se configuran por la consola.
+ ** Termina con error si alguna respuesta o el estado del zumbador no coinciden.
+ **
+ ** Uso: commands
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup host Compilacion en el host
+ ** @brief Verificacion de los comandos de la consola
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "chip.h"
+#include "app.h"
+#include "bsp.h"
+#include "trace.h"
+#include "serial.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Ticks entre llamadas a AppLoop, igual que en el simulador
+#define LOOP_PERIOD_TICKS 10
+
+// Ticks maximos que se espera una respuesta antes de darla por perdida
+#define ANSWER_TICKS 200
+
+#define ELEMENTS(array) (sizeof(array) / sizeof(array[0]))
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+// Paso de la verificacion: linea enviada, respuesta esperada y segundos que se dejan correr despues
+typedef struct step_s {
+    const char * line;
+    const char * answer;
+    uint32_t seconds;       //!< Segundos simulados despues de la respuesta, cero para no esperar
+    bool ringing;           //!< Estado del zumbador esperado al terminar la espera
+} const * step_t;
+
+/* === Definiciones de variables privadas ================================== */
+
+// El 1 de enero de 2024 fue lunes y el 6 sabado
+static const struct step_s STEPS[] = {
+    {"fecha 2024-01-01", "2024-01-01\r\n", 0, false},
+    {"hora 7:29", "07:29:00\r\n", 0, false},
+    {"alarma 7:30 67", "07:30 activada, dias 67, hoy 1\r\n", 61, false},
+    {"alarma 7:32 12345", "07:32 activada, dias 12345, hoy 1\r\n", 121, true},
+    {"apagar", "alarma desactivada\r\n", 1, false},
+    {"alarma 7:40 8", "dias invalidos, del 1 (lunes) al 7 (domingo)\r\n", 0, false},
+    {"alarma 7:40 0", "dias invalidos, del 1 (lunes) al 7 (domingo)\r\n", 0, false},
+    {"alarma", "07:32 desactivada, dias 12345, hoy 1\r\n", 0, false},
+    {"alarma 7:35", "07:35 activada, dias 12345, hoy 1\r\n", 0, false},
+    {"fecha 2024-01-06", "2024-01-06\r\n", 0, false},
+    {"alarma", "07:35 activada, dias 12345, hoy 6\r\n", 181, false},
+    {"alarma 7:37 7654321", "07:37 activada, dias 1234567, hoy 6\r\n", 121, true},
+};
+
+static board_t board;
+
+static uint32_t ticks = 0;
+
+// Linea que recibe la consola con su retorno y lo que escribio desde el ultimo paso
+static char input[64];
+
+static uint16_t pending = 0;
+
+static char output[256];
+
+static uint16_t written = 0;
+
+/* === Definiciones de variables publicas ================================== */
+
+uint32_t HostSerialReceived = 0;
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static void Step(void);
+
+static bool Check(step_t step);
+
+/* === Definiciones de funciones privadas ================================== */
+
+// Igual que el SysTick_Handler del simulador, sin ticks perdidos
+static void Step(void){
+    HostCyclesAdvance(SystemCoreClock / APP_TICKS_PER_SECOND);
+    ticks++;
+    AppTick();
+    if (ticks % LOOP_PERIOD_TICKS == 0){
+        AppLoop();
+    }
+}
+
+static bool Check(step_t step){
+    bool result;
+
+    written = 0;
+    output[0] = 0;
+    pending = snprintf(input, sizeof(input), "%s\r", step->line);
+    for (uint32_t tick = 0; (tick < ANSWER_TICKS) && !strstr(output, "\r\n"); tick++){
+        Step();
+    }
+    for (uint32_t tick = 0; tick < step->seconds * APP_TICKS_PER_SECOND; tick++){
+        Step();
+    }
+
+    result = (strcmp(output, step->answer) == 0) && (BuzzerIsRinging(board->buzzer) == step->ringing);
+    printf("%-22s %-45.*s zumbador %-9s %s\n", step->line, (int) strcspn(output, "\r\n"), output,
+        BuzzerIsRinging(board->buzzer) ? "sonando" : "apagado", result ? "bien" : "ERROR");
+    if (!result){
+        printf("  esperado: %.*s, zumbador %s\n", (int) strcspn(step->answer, "\r\n"), step->answer,
+            step->ringing ? "sonando" : "apagado");
+    }
+    return result;
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+// Reemplaza a la pseudo terminal, la linea del paso se entrega en cuanto la consola la lee
+bool HostSerialOpen(void){
+    return true;
+}
+
+uint16_t HostSerialRead(uint8_t * data, uint16_t size){
+    uint16_t count = (pending < size) ? pending : size;
+
+    memcpy(data, &input[strlen(input) - pending], count);
+    pending -= count;
+    HostSerialReceived += count;
+    return count;
+}
+
+void HostSerialWrite(uint8_t const * data, uint16_t size){
+    while ((size > 0) && (written < sizeof(output) - 1)){
+        output[written++] = *data++;
+        size--;
+    }
+    output[written] = 0;
+}
+
+int main(void){
+    uint32_t errors = 0;
+
+    TraceInit();
+    board = BoardCreate();
+    if (!AppInit(board)){
+        fprintf(stderr, "No se pudieron registrar todos los consumidores del despachador\n");
+        return EXIT_FAILURE;
+    }
+    SisTick_Init(APP_TICKS_PER_SECOND);
+
+    for (unsigned index = 0; index < ELEMENTS(STEPS); index++){
+        if (!Check(&STEPS[index])) errors++;
+    }
+    printf("%u pasos, %lu errores\n", (unsigned) ELEMENTS(STEPS), (unsigned long) errors);
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
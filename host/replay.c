@@ -0,0 +1,287 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file replay.c
+ **
+ ** @brief Reproduccion en el host de una sesion grabada
+ **
+ ** Lee una grabacion hecha por el simulador o volcada de la placa, aplica los mismos flancos
+ ** de teclas y ticks perdidos a la logica de la aplicacion a maxima velocidad, llamando al
+ ** lazo principal despues de los ticks en los que se grabaron sus vueltas, y compara los
+ ** cuadros que llegan a la pantalla y el estado del reloj con los grabados. Termina con
+ ** error en la primera diferencia, con lo que sirve para reproducir una falla y para
+ ** verificar que un cambio no altera el comportamiento. Cada vuelta se reproduce entera
+ ** despues de su tick, una vuelta de la placa que fue interrumpida por un tick que cambio
+ ** lo que leia puede no coincidir, igual que una sesion que usa los comandos de la consola
+ ** o el pulso de referencia, que no se graban.
+ ** 
+ ** Uso: replay <archivo>
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup host Compilacion en el host
+ ** @brief Reproduccion de sesiones grabadas
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "chip.h"
+#include "app.h"
+#include "bsp.h"
+#include "poncho.h"
+#include "trace.h"
+#include "record.h"
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+#define ELEMENTS(array) (sizeof(array) / sizeof(array[0]))
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+// Terminal de cada tecla, en el orden de trace_key_t
+typedef struct key_pin_s {
+    uint8_t gpio;
+    uint8_t bit;
+} const * key_pin_t;
+
+/* === Definiciones de variables privadas ================================== */
+
+static const struct key_pin_s KEYS[] = {
+    [TRACE_KEY_SET_TIME] = {TEC_F1_GPIO, TEC_F1_BIT},
+    [TRACE_KEY_SET_ALARM] = {TEC_F2_GPIO, TEC_F2_BIT},
+    [TRACE_KEY_DECREMENT] = {TEC_F4_GPIO, TEC_F4_BIT},
+    [TRACE_KEY_INCREMENT] = {TEC_F3_GPIO, TEC_F3_BIT},
+    [TRACE_KEY_ACCEPT] = {TEC_ACCEPT_GPIO, TEC_ACCEPT_BIT},
+    [TRACE_KEY_CANCEL] = {TEC_CANCEL_GPIO, TEC_CANCEL_BIT},
+};
+
+// Grabacion original, la reproduccion se graba en RecordBuffer y se compara contra esta
+static record_buffer_t original;
+
+// Ticks simulados, sin contar los recuperados, igual que en el simulador
+static uint32_t ticks = 0;
+
+// Ticks de la aplicacion, incluidos los recuperados, es la base de tiempo de la grabacion
+static uint32_t app_ticks = 0;
+
+// Tramo de vueltas del lazo que se esta reproduciendo: tick de la proxima vuelta, periodo y vueltas pendientes
+static uint32_t loop_tick = 0;
+
+static uint32_t loop_period = 0;
+
+static uint32_t loop_pending = 0;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static bool Load(const char * name);
+
+static void Step(void);
+
+static void AdvanceTo(uint32_t tick);
+
+static uint32_t EntryTick(record_buffer_t const * buffer, uint32_t * index, uint32_t * tick);
+
+static void Describe(char const * label, uint32_t tick, record_entry_t const * entry);
+
+static bool Compare(void);
+
+/* === Definiciones de funciones privadas ================================== */
+
+static bool Load(const char * name){
+    FILE * file = fopen(name, "rb");
+    bool result = (file != NULL);
+
+    if (result){
+        result = (fread(&original, offsetof(record_buffer_t, entry), 1, file) == 1) && (original.magic == RECORD_MAGIC) &&
+            (original.entry_size == sizeof(record_entry_t)) && (original.head <= RECORD_ENTRIES);
+        if (result){
+            result = (fread(original.entry, sizeof(record_entry_t), original.head, file) == original.head);
+        }
+        fclose(file);
+    }
+    if (!result) fprintf(stderr, "%s: no es una grabacion valida\n", name);
+    return result;
+}
+
+// Igual que el SysTick_Handler del simulador, sin ticks perdidos propios, con el lazo donde se grabo
+static void Step(void){
+    HostCyclesAdvance(SystemCoreClock / original.rate);
+    ticks++;
+    app_ticks++;
+    AppTick();
+    if (loop_pending && (app_ticks == loop_tick)){
+        AppLoop();
+        loop_tick += loop_period;
+        loop_pending--;
+    }
+}
+
+static void AdvanceTo(uint32_t tick){
+    while ((int32_t)(tick - app_ticks) > 0){
+        Step();
+    }
+}
+
+// Avanza hasta el proximo registro que no es una espera, devuelve su indice o head si no quedan
+static uint32_t EntryTick(record_buffer_t const * buffer, uint32_t * index, uint32_t * tick){
+    while (*index < buffer->head){
+        record_entry_t const * entry = &buffer->entry[*index];
+
+        if (entry->kind == RECORD_WAIT){
+            *tick += entry->value;
+            (*index)++;
+        } else {
+            *tick += entry->delta;
+            return *index;
+        }
+    }
+    return buffer->head;
+}
+
+static void Describe(char const * label, uint32_t tick, record_entry_t const * entry){
+    printf("  %-11s tick %10u: ", label, tick);
+    if (entry == NULL){
+        printf("sin registro\n");
+    } else if (entry->kind == RECORD_KEY){
+        printf("tecla %u %s\n", entry->arg, entry->value ? "presionada" : "liberada");
+    } else if (entry->kind == RECORD_LOST){
+        printf("%u ticks perdidos\n", entry->value);
+    } else if (entry->kind == RECORD_LOOP){
+        printf("%u vueltas del lazo cada %u ticks\n", entry->value, entry->arg);
+    } else if (entry->kind == RECORD_FRAME){
+        printf("segmentos %02x %02x %02x %02x\n", entry->value & 0xFF, (entry->value >> 8) & 0xFF,
+            (entry->value >> 16) & 0xFF, entry->value >> 24);
+    } else {
+        printf("reloj %02x:%02x:%02x%s%s\n", entry->value >> 16, (entry->value >> 8) & 0xFF, entry->value & 0xFF,
+            (entry->arg & RECORD_CLOCK_VALID) ? "" : " sin ajustar", (entry->arg & RECORD_CLOCK_ALARM) ? " alarma" : "");
+    }
+}
+
+// Compara registro por registro, el tick puede diferir si la grabacion viene de la placa y no se informa como error
+static bool Compare(void){
+    uint32_t expected = 0, got = 0;
+    uint32_t expected_tick = 0, got_tick = 0;
+    uint32_t frames = 0;
+
+    while (true){
+        record_entry_t const * a;
+        record_entry_t const * b;
+
+        expected = EntryTick(&original, &expected, &expected_tick);
+        got = EntryTick(&RecordBuffer, &got, &got_tick);
+        if (expected == original.head) break;
+
+        a = &original.entry[expected];
+        b = (got < RecordBuffer.head) ? &RecordBuffer.entry[got] : NULL;
+        if ((b == NULL) || (a->kind != b->kind) || (a->arg != b->arg) || (a->value != b->value)){
+            printf("Diferencia en el registro %u\n", expected);
+            Describe("grabado", expected_tick, a);
+            Describe("reproducido", got_tick, b);
+            return false;
+        }
+        if (a->kind == RECORD_FRAME) frames++;
+        expected++;
+        got++;
+    }
+    printf("%u registros y %u cuadros coinciden con la grabacion%s\n", original.head, frames,
+        (original.flags & RECORD_FLAG_FULL) ? ", que se detuvo por buffer lleno" : "");
+    return true;
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+int main(int argc, char * argv[]){
+    uint32_t index = 0, tick = 0;
+
+    if (argc != 2){
+        fprintf(stderr, "Uso: %s <archivo>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!Load(argv[1])) return EXIT_FAILURE;
+    if (original.rate != APP_TICKS_PER_SECOND){
+        fprintf(stderr, "%s: grabada con %u ticks por segundo, la aplicacion usa %u\n", argv[1], original.rate,
+            APP_TICKS_PER_SECOND);
+        return EXIT_FAILURE;
+    }
+    if (original.flags & RECORD_FLAG_UNRECORDED){
+        fprintf(stderr, "%s: la sesion uso la consola o el pulso de referencia, que no se graban\n", argv[1]);
+    }
+
+    TraceInit();
+    if (!AppInit(BoardCreate())){
+        fprintf(stderr, "No se pudieron registrar todos los consumidores del despachador\n");
+        return EXIT_FAILURE;
+    }
+    SisTick_Init(APP_TICKS_PER_SECOND);
+
+    /* Solo se aplican las entradas, los cuadros y el estado del reloj se generan de nuevo */
+    while ((index = EntryTick(&original, &index, &tick)) < original.head){
+        record_entry_t const * entry = &original.entry[index];
+
+        if ((entry->kind == RECORD_KEY) && (entry->arg < ELEMENTS(KEYS))){
+            /* El flanco se grabo en el tick que lo muestreo, el terminal cambia justo antes */
+            AdvanceTo(tick - 1);
+            HostPinSet(KEYS[entry->arg].gpio, KEYS[entry->arg].bit, entry->value);
+        } else if (entry->kind == RECORD_LOST){
+            AdvanceTo(tick);
+            HostCyclesAdvance((uint64_t) entry->value * SystemCoreClock / original.rate);
+            app_ticks += entry->value;
+            AppCatchUp(entry->value);
+        } else if (entry->kind == RECORD_LOOP){
+            /* La primera vuelta del tramo corre despues del tick del registro, el tramo anterior ya termino */
+            AdvanceTo(tick - 1);
+            loop_tick = tick;
+            loop_period = entry->arg;
+            loop_pending = entry->value;
+        }
+        index++;
+    }
+    /* El ultimo tramo del lazo puede seguir despues del ultimo registro, cada vuelta se graba en el tick siguiente */
+    AdvanceTo(tick);
+    if (loop_pending) AdvanceTo(loop_tick + (loop_pending - 1) * loop_period + 1);
+
+    return Compare() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
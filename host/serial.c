@@ -0,0 +1,128 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file serial.c
+ **
+ ** @brief Puerto serie del host sobre una pseudo terminal
+ **
+ ** Pseudo terminal en modo crudo que hace las veces de la UART de la placa
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup host Compilacion en el host
+ ** @brief Puerto serie en el host
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#define _XOPEN_SOURCE 600
+
+#include "serial.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+/* === Definiciones de variables privadas ================================== */
+
+static int master = -1;
+
+// Se mantiene abierto el lado esclavo para que la pseudo terminal no se cierre al desconectarse el cliente
+static int slave = -1;
+
+/* === Definiciones de variables publicas ================================== */
+
+uint32_t HostSerialReceived = 0;
+
+/* === Declaraciones de funciones privadas ================================= */
+
+/* === Definiciones de funciones privadas ================================== */
+
+/* === Definiciones de funciones publicas ================================== */
+
+bool HostSerialOpen(void){
+    struct termios raw;
+    const char * name;
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0) || ((name = ptsname(master)) == NULL)){
+        perror("pseudo terminal");
+        return false;
+    }
+
+    slave = open(name, O_RDWR | O_NOCTTY);
+    if ((slave >= 0) && (tcgetattr(slave, &raw) == 0)){
+        raw.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON);
+        raw.c_oflag &= ~OPOST;
+        raw.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+        tcsetattr(slave, TCSANOW, &raw);
+    }
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+    fprintf(stderr, "Consola serie en %s\n", name);
+    return true;
+}
+
+uint16_t HostSerialRead(uint8_t * data, uint16_t size){
+    ssize_t count;
+
+    if (master < 0) return 0;
+    count = read(master, data, size);
+    if (count <= 0) return 0;
+    HostSerialReceived += count;
+    return count;
+}
+
+void HostSerialWrite(uint8_t const * data, uint16_t size){
+    if (master < 0) return;
+    while (size > 0){
+        ssize_t count = write(master, data, size);
+
+        if (count <= 0) break;
+        data += count;
+        size -= count;
+    }
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,480 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file simulator.c
+ **
+ ** @brief Simulador en la terminal del reloj despertador
+ **
+ ** Ejecuta la logica de la aplicacion sobre la placa simulada del host, dibuja los
+ ** cuatro digitos de siete segmentos, los puntos y los leds en la terminal y
+ ** convierte las teclas del teclado en pulsaciones de las teclas de la placa. El
+ ** tiempo simulado puede avanzar en tiempo real, sesenta veces mas rapido o tan
+ ** rapido como sea posible.
+ ** 
+ ** Uso: simulator [-s 1|60|max] [-t segundos] [-d archivo] [-r archivo] [-p ppm] [-l archivo] [-j ticks]
+ **   -s    Velocidad inicial de la simulacion
+ **   -t    Termina despues de simular la cantidad de segundos indicada
+ **   -d    Al terminar guarda el registro de eventos para trace_decode
+ **   -r    Al terminar guarda la grabacion de la sesion para replay
+ **   -p    Genera el pulso por segundo de una referencia externa, con el cristal
+ **         de la placa adelantado en los ppm indicados respecto de la referencia
+ **   -l    Toma las conversiones del sensor de luz de un archivo de texto con una
+ **         linea "segundos valor" por cada cambio, el valor entre 0 y 1023 se
+ **         mantiene hasta la linea siguiente y las lineas con # se ignoran
+ **   -j    Alarga cada vuelta del lazo principal entre cero y los ticks indicados,
+ **         como el lazo libre de la placa, para probar la reproduccion de sus volcados
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup host Compilacion en el host
+ ** @brief Simulador del reloj despertador
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "chip.h"
+#include "app.h"
+#include "bsp.h"
+#include "poncho.h"
+#include "ciaa.h"
+#include "trace.h"
+#include "record.h"
+#include "max7219.h"
+#include "terminal.h"
+#include "serial.h"
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Ticks entre llamadas a AppLoop, equivale a la demora del lazo principal en la placa
+#define LOOP_PERIOD_TICKS 10
+
+// Duracion en milisegundos simulados de una pulsacion de tecla
+#define KEY_PRESS_MS 100
+
+// Duracion en milisegundos del pulso por segundo de la referencia simulada
+#define PPS_WIDTH_MS 10
+
+// Tiempo real entre dos dibujos de la pantalla, en microsegundos
+#define FRAME_PERIOD_US 40000
+
+// Ticks simulados por cuadro cuando se corre a maxima velocidad
+#define MAX_SPEED_TICKS 200000
+
+#define SCREEN_DIGITS 4
+
+// Cambios de luz que se pueden leer del archivo
+#define LIGHT_POINTS 256
+
+#define ELEMENTS(array) (sizeof(array) / sizeof(array[0]))
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+typedef struct key_s {
+    const char * keys;      //!< Teclas del teclado asociadas
+    const char * name;      //!< Nombre de la tecla de la placa
+    uint8_t gpio;
+    uint8_t bit;
+} const * key_t;
+
+// Cambio de la luz simulada, el valor se mantiene hasta el proximo cambio
+typedef struct light_point_s {
+    uint64_t time;          //!< Momento del cambio en milisegundos simulados
+    uint16_t value;         //!< Resultado de la conversion desde ese momento
+} light_point_t;
+
+typedef struct led_s {
+    const char * name;
+    uint8_t gpio;
+    uint8_t bit;
+} const * led_t;
+
+/* === Definiciones de variables privadas ================================== */
+
+static const struct key_s KEYS[] = {
+    {"tT", "F1 ajustar hora", TEC_F1_GPIO, TEC_F1_BIT},
+    {"aA", "F2 ajustar alarma", TEC_F2_GPIO, TEC_F2_BIT},
+    {"+=", "F3 incrementar", TEC_F3_GPIO, TEC_F3_BIT},
+    {"-_", "F4 decrementar", TEC_F4_GPIO, TEC_F4_BIT},
+    {"\n\r ", "aceptar", TEC_ACCEPT_GPIO, TEC_ACCEPT_BIT},
+    {"xX\b\x7f", "cancelar", TEC_CANCEL_GPIO, TEC_CANCEL_BIT},
+};
+
+static const struct led_s LEDS[] = {
+    {"R", LED_R_GPIO, LED_R_BIT},
+    {"G", LED_G_GPIO, LED_G_BIT},
+    {"B", LED_B_GPIO, LED_B_BIT},
+    {"1", LED_1_GPIO, LED_1_BIT},
+    {"2", LED_2_GPIO, LED_2_BIT},
+    {"3", LED_3_GPIO, LED_3_BIT},
+};
+
+// Segmentos mostrados en cada posicion, se actualizan cada vez que se enciende un digito
+static uint8_t screen[SCREEN_DIGITS];
+
+// Tick simulado hasta el cual cada tecla se mantiene presionada
+static uint64_t released_at[ELEMENTS(KEYS)];
+
+static uint64_t ticks = 0;
+
+static uint32_t ticks_per_second;
+
+// Tick simulado de la proxima vuelta del lazo principal y demora maxima agregada a cada vuelta con -j
+static uint64_t next_loop = LOOP_PERIOD_TICKS;
+
+static uint32_t loop_jitter = 0;
+
+// Error del cristal de la placa respecto de la referencia, el pulso solo se genera si se pidio con -p
+static bool pps = false;
+
+static int32_t pps_ppm = 0;
+
+// Luz simulada leida con -l, sin cambios el ADC no entrega conversiones y el brillo no se modifica
+static light_point_t light[LIGHT_POINTS];
+
+static unsigned light_points = 0;
+
+static unsigned light_index = 0;
+
+static board_t board;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static void SimulateTick(void);
+
+static void CaptureScreen(void);
+
+static bool ProcessKey(int key, uint32_t * speed);
+
+static void Render(uint32_t speed);
+
+static bool SaveRecord(const char * name);
+
+static bool LoadLight(const char * name);
+
+/* === Definiciones de funciones privadas ================================== */
+
+static void SimulateTick(void){
+    uint32_t lost;
+
+    HostCyclesAdvance(SystemCoreClock / ticks_per_second);
+    ticks++;
+
+    for (unsigned index = 0; index < ELEMENTS(KEYS); index++){
+        if (released_at[index] == ticks){
+            HostPinSet(KEYS[index].gpio, KEYS[index].bit, false);
+        }
+    }
+
+    // Los ticks de la placa medidos con la referencia, que avanza mas lento si el cristal adelanta
+    if (pps){
+        uint64_t reference = ticks * 1000000 / (1000000 + pps_ppm);
+        HostPinSet(PPS_GPIO, PPS_BIT, reference % ticks_per_second < (uint64_t) PPS_WIDTH_MS * ticks_per_second / 1000);
+    }
+
+    // Una conversion del sensor por tick, con el valor del ultimo cambio alcanzado
+    if (light_points && (ticks * 1000 >= light[0].time * ticks_per_second)){
+        while ((light_index + 1 < light_points) && (ticks * 1000 >= light[light_index + 1].time * ticks_per_second)){
+            light_index++;
+        }
+        HostAdcSample(light[light_index].value);
+    }
+
+    // Igual que el SysTick_Handler de la placa
+    lost = SisTick_Lost();
+    if (lost) AppCatchUp(lost);
+    AppTick();
+    CaptureScreen();
+
+    if (ticks == next_loop){
+        AppLoop();
+        /* Sin -j la secuencia de numeros no se usa y el lazo mantiene el periodo fijo */
+        next_loop = ticks + LOOP_PERIOD_TICKS + (loop_jitter ? (uint32_t) rand() % (loop_jitter + 1) : 0);
+    }
+}
+
+#ifdef MAX7219_DISPLAY_DIGITS
+// Lee los registros de digito del controlador modelado
+static void CaptureScreen(void){
+    for (uint8_t digit = 0; digit < SCREEN_DIGITS; digit++){
+        uint8_t data = HostController.registers[MAX7219_DIGIT(digit)];
+        uint8_t segments = 0;
+
+        for (uint8_t segment = 0; segment < 8; segment++){
+            if (data & MAX7219_SEGMENT_BIT(segment)) segments |= 1 << segment;
+        }
+        screen[digit] = segments;
+    }
+}
+#else
+// Lee los terminales de la pantalla multiplexada para saber que muestra el digito activo
+static void CaptureScreen(void){
+    for (uint8_t bit = 0; bit < SCREEN_DIGITS; bit++){
+        if (LPC_GPIO_PORT->B[DIGITS_GPIO][bit]){
+            uint8_t segments = 0;
+
+            for (uint8_t segment = 0; segment < 7; segment++){
+                segments |= LPC_GPIO_PORT->B[SEGMENTS_GPIO][segment] << segment;
+            }
+            if (LPC_GPIO_PORT->B[SEGMENT_P_GPIO][SEGMENT_P_BIT]) segments |= SEGMENT_P;
+            screen[SCREEN_DIGITS - 1 - bit] = segments;
+        }
+    }
+}
+#endif
+
+static bool ProcessKey(int key, uint32_t * speed){
+    switch (key){
+    case 'q':
+    case 'Q':
+        return false;
+    case '1':
+        *speed = 1;
+        return true;
+    case '2':
+        *speed = 60;
+        return true;
+    case '3':
+        *speed = 0;
+        return true;
+    default:
+        break;
+    }
+
+    for (unsigned index = 0; index < ELEMENTS(KEYS); index++){
+        if ((key > 0) && strchr(KEYS[index].keys, key)){
+            HostPinSet(KEYS[index].gpio, KEYS[index].bit, true);
+            released_at[index] = ticks + (uint64_t) KEY_PRESS_MS * ticks_per_second / 1000;
+        }
+    }
+    return true;
+}
+
+static void Render(uint32_t speed){
+    static const char * const ROWS[3][2] = {
+        {" ", "_"}, {"|", "_"}, {"|", "_"},
+    };
+    uint64_t seconds = ticks / ticks_per_second;
+
+    printf("\033[H\033[2J");
+    printf("Tiempo simulado: %llu d %02llu:%02llu:%02llu   velocidad: ", (unsigned long long)(seconds / 86400),
+        (unsigned long long)(seconds / 3600 % 24), (unsigned long long)(seconds / 60 % 60), (unsigned long long)(seconds % 60));
+    if (speed) printf("%ux\n\n", speed); else printf("maxima\n\n");
+
+    // Fila superior: segmento A
+    for (int digit = 0; digit < SCREEN_DIGITS; digit++){
+        printf("  %s   ", ROWS[0][(screen[digit] & SEGMENT_A) != 0]);
+    }
+    printf("\n");
+    // Fila media: segmentos F, G y B
+    for (int digit = 0; digit < SCREEN_DIGITS; digit++){
+        printf(" %s%s%s  ", (screen[digit] & SEGMENT_F) ? ROWS[1][0] : " ",
+            (screen[digit] & SEGMENT_G) ? ROWS[1][1] : " ", (screen[digit] & SEGMENT_B) ? ROWS[1][0] : " ");
+    }
+    printf("\n");
+    // Fila inferior: segmentos E, D, C y el punto
+    for (int digit = 0; digit < SCREEN_DIGITS; digit++){
+        printf(" %s%s%s%s ", (screen[digit] & SEGMENT_E) ? ROWS[2][0] : " ",
+            (screen[digit] & SEGMENT_D) ? ROWS[2][1] : " ", (screen[digit] & SEGMENT_C) ? ROWS[2][0] : " ",
+            (screen[digit] & SEGMENT_P) ? "." : " ");
+    }
+    printf("\n\nLeds: ");
+    for (unsigned index = 0; index < ELEMENTS(LEDS); index++){
+        printf("[%s] ", LPC_GPIO_PORT->B[LEDS[index].gpio][LEDS[index].bit] ? LEDS[index].name : " ");
+    }
+    printf("  Zumbador: %s\n\n", LPC_GPIO_PORT->B[BUZZER_GPIO][BUZZER_BIT] ? "SONANDO" : "apagado");
+    printf("Brillo: %u/%u", DisplayGetBrightness(board->display) + 1, DISPLAY_BRIGHTNESS_LEVELS);
+    if (light_points) printf("   luz: %u", light[light_index].value);
+    printf("\n\n");
+#ifdef MAX7219_DISPLAY_DIGITS
+    printf("Controlador: %u palabras en %u rafagas\n\n", HostController.words, HostController.bursts);
+#endif
+
+    printf("Teclas: t = F1 ajustar hora, a = F2 ajustar alarma, + = F3 incrementar, - = F4 decrementar\n");
+    printf("        Enter = aceptar, x = cancelar, 1/2/3 = velocidad 1x/60x/maxima, q = salir\n");
+    fflush(stdout);
+}
+
+// Guarda la cabecera y solo los registros escritos de la grabacion
+static bool SaveRecord(const char * name){
+    FILE * file = fopen(name, "wb");
+    bool result = (file != NULL);
+
+    if (pps || HostSerialReceived) RecordBuffer.flags |= RECORD_FLAG_UNRECORDED;
+    if (result){
+        result = (fwrite(&RecordBuffer, offsetof(record_buffer_t, entry), 1, file) == 1);
+        if (result && RecordBuffer.head){
+            result = (fwrite(RecordBuffer.entry, sizeof(record_entry_t), RecordBuffer.head, file) == RecordBuffer.head);
+        }
+        result = (fclose(file) == 0) && result;
+    }
+    if (!result) perror(name);
+    return result;
+}
+
+// Lee los cambios de luz, deben estar ordenados por tiempo
+static bool LoadLight(const char * name){
+    FILE * file = fopen(name, "r");
+    char line[80];
+    unsigned number = 0;
+
+    if (file == NULL){
+        perror(name);
+        return false;
+    }
+    while (fgets(line, sizeof(line), file)){
+        double seconds;
+        unsigned value;
+
+        number++;
+        if ((line[strspn(line, " \t")] == '#') || (strspn(line, " \t\r\n") == strlen(line))) continue;
+        if ((sscanf(line, "%lf %u", &seconds, &value) != 2) || (seconds < 0) || (value > 1023)
+            || (light_points && (seconds * 1000 < light[light_points - 1].time)) || (light_points == LIGHT_POINTS)){
+            fprintf(stderr, "%s:%u: se esperaba \"segundos valor\" en orden, con un valor entre 0 y 1023\n", name, number);
+            fclose(file);
+            return false;
+        }
+        light[light_points].time = (uint64_t) (seconds * 1000);
+        light[light_points].value = value;
+        light_points++;
+    }
+    fclose(file);
+    return true;
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+int main(int argc, char * argv[]){
+    uint32_t speed = 1;
+    uint64_t limit = 0;
+    const char * dump = NULL;
+    const char * record = NULL;
+    bool interactive, running = true;
+    uint64_t started, frames = 0;
+
+    for (int index = 1; index < argc; index++){
+        if ((strcmp(argv[index], "-s") == 0) && (index + 1 < argc)){
+            index++;
+            speed = (strcmp(argv[index], "max") == 0) ? 0 : strtoul(argv[index], NULL, 10);
+        } else if ((strcmp(argv[index], "-t") == 0) && (index + 1 < argc)){
+            limit = strtoull(argv[++index], NULL, 10);
+        } else if ((strcmp(argv[index], "-d") == 0) && (index + 1 < argc)){
+            dump = argv[++index];
+        } else if ((strcmp(argv[index], "-r") == 0) && (index + 1 < argc)){
+            record = argv[++index];
+        } else if ((strcmp(argv[index], "-p") == 0) && (index + 1 < argc)){
+            pps = true;
+            pps_ppm = strtol(argv[++index], NULL, 10);
+        } else if ((strcmp(argv[index], "-l") == 0) && (index + 1 < argc)){
+            if (!LoadLight(argv[++index])) return EXIT_FAILURE;
+        } else if ((strcmp(argv[index], "-j") == 0) && (index + 1 < argc)){
+            loop_jitter = strtoul(argv[++index], NULL, 10);
+        } else {
+            fprintf(stderr, "Uso: %s [-s 1|60|max] [-t segundos] [-d archivo] [-r archivo] [-p ppm] [-l archivo] [-j ticks]\n",
+                argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    TraceInit();
+    board = BoardCreate();
+    if (!AppInit(board)){
+        fprintf(stderr, "No se pudieron registrar todos los consumidores del despachador\n");
+        return EXIT_FAILURE;
+    }
+    SisTick_Init(APP_TICKS_PER_SECOND);
+    ticks_per_second = HostSysTickRate;
+
+    interactive = TerminalOpen();
+    started = HostNanoseconds();
+
+    while (running){
+        uint64_t target;
+        int key;
+
+        while ((key = TerminalRead()) >= 0){
+            running = ProcessKey(key, &speed) && running;
+        }
+
+        // Se simulan los ticks necesarios para alcanzar el tiempo real multiplicado por la velocidad
+        if (speed){
+            target = ticks + (uint64_t) speed * ticks_per_second * FRAME_PERIOD_US / 1000000;
+        } else {
+            target = ticks + MAX_SPEED_TICKS;
+        }
+        if (limit && (target > limit * ticks_per_second)){
+            target = limit * ticks_per_second;
+            running = false;
+        }
+        while (ticks < target){
+            SimulateTick();
+        }
+
+        if (interactive || !running) Render(speed);
+
+        frames++;
+        if (speed){
+            uint64_t next = started + frames * FRAME_PERIOD_US * 1000ULL;
+            uint64_t now = HostNanoseconds();
+            if (next > now) TerminalSleep((next - now) / 1000);
+        }
+    }
+
+    TerminalClose();
+
+    if (dump){
+        FILE * file = fopen(dump, "wb");
+        if ((file == NULL) || (fwrite(&TraceBuffer, sizeof(TraceBuffer), 1, file) != 1)){
+            perror(dump);
+            return EXIT_FAILURE;
+        }
+        fclose(file);
+    }
+    if (record && !SaveRecord(record)){
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
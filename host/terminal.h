@@ -0,0 +1,106 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file terminal.h
+ **
+ ** @brief Manejo de la terminal para las herramientas del host
+ **
+ ** Funciones de entrada y salida de la terminal separadas de las herramientas,
+ ** para que las cabeceras POSIX no se mezclen con las del firmware.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup host Compilacion en el host
+ ** @brief Manejo de la terminal en el host
+ ** @{
+ */
+
+#ifndef TERMINAL_H   /*! @cond    */
+#define TERMINAL_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Pone la entrada estandar en modo sin eco ni espera de linea
+ *
+ * @return true     La entrada es una terminal interactiva
+ * @return false    La entrada no es una terminal y no se modifico
+ */
+bool TerminalOpen(void);
+
+/**
+ * @brief Restaura la configuracion original de la terminal
+ */
+void TerminalClose(void);
+
+/**
+ * @brief Lee una tecla sin bloquear
+ *
+ * @return int  Codigo de la tecla o -1 si no hay ninguna pendiente
+ */
+int TerminalRead(void);
+
+/**
+ * @brief Detiene la ejecucion durante el tiempo indicado
+ *
+ * @param microseconds  Tiempo de espera en microsegundos
+ */
+void TerminalSleep(uint32_t microseconds);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* TERMINAL_H */
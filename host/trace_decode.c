@@ -0,0 +1,202 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file trace_decode.c
+ **
+ ** @brief Decodificador en el host del registro binario de eventos
+ **
+ ** Lee un volcado de memoria del equipo (o el buffer escrito por la compilacion
+ ** para el host), localiza el buffer de eventos por su identificador y lo imprime
+ ** como una linea de tiempo ordenada del registro mas antiguo al mas reciente.
+ ** 
+ ** Uso: trace_decode <archivo> [frecuencia en Hz]
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup trace Registro de eventos
+ ** @brief Registro binario de eventos en RAM
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "trace.h"
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+#define ELEMENTS(array) (sizeof(array) / sizeof(array[0]))
+
+#define MODE_NAME(mode) #mode,
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+/* === Definiciones de variables privadas ================================== */
+
+static const char * const EVENTS[] = {
+    [TRACE_EVENT_TICK] = "TICK",
+    [TRACE_EVENT_MODE] = "MODO",
+    [TRACE_EVENT_ALARM] = "ALARMA",
+    [TRACE_EVENT_KEY] = "TECLA",
+};
+
+static const char * const MODES[] = {
+    TRACE_MODES(MODE_NAME)
+};
+
+static const char * const KEYS[] = {
+    [TRACE_KEY_SET_TIME] = "F1 (ajustar hora)",
+    [TRACE_KEY_SET_ALARM] = "F2 (ajustar alarma)",
+    [TRACE_KEY_DECREMENT] = "F4 (decrementar)",
+    [TRACE_KEY_INCREMENT] = "F3 (incrementar)",
+    [TRACE_KEY_ACCEPT] = "Aceptar",
+    [TRACE_KEY_CANCEL] = "Cancelar",
+};
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static const trace_buffer_t * FindBuffer(const uint8_t * data, size_t size);
+
+static void PrintArgument(const trace_record_t * record);
+
+/* === Definiciones de funciones privadas ================================== */
+
+// Busca el encabezado del buffer en posiciones alineadas a cuatro bytes del volcado
+static const trace_buffer_t * FindBuffer(const uint8_t * data, size_t size){
+    for (size_t offset = 0; offset + offsetof(trace_buffer_t, record) <= size; offset += 4){
+        const trace_buffer_t * buffer = (const trace_buffer_t *)(data + offset);
+        size_t length;
+
+        if (buffer->magic != TRACE_MAGIC) continue;
+        if (buffer->record_size != sizeof(trace_record_t)) continue;
+        if ((buffer->records == 0) || (buffer->records & (buffer->records - 1))) continue;
+
+        length = offsetof(trace_buffer_t, record) + (size_t) buffer->records * sizeof(trace_record_t);
+        if (offset + length <= size) return buffer;
+    }
+    return NULL;
+}
+
+static void PrintArgument(const trace_record_t * record){
+    switch (record->event){
+    case TRACE_EVENT_MODE:
+        printf("%s\n", record->arg < ELEMENTS(MODES) ? MODES[record->arg] : "?");
+        break;
+    case TRACE_EVENT_ALARM:
+        printf("%X%X:%X%X\n", (record->arg >> 12) & 0x0F, (record->arg >> 8) & 0x0F,
+            (record->arg >> 4) & 0x0F, record->arg & 0x0F);
+        break;
+    case TRACE_EVENT_KEY:
+        printf("%s\n", record->arg < ELEMENTS(KEYS) ? KEYS[record->arg] : "?");
+        break;
+    default:
+        printf("%u\n", record->arg);
+        break;
+    }
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+int main(int argc, char * argv[]){
+    FILE * file;
+    uint8_t * data;
+    long size;
+    const trace_buffer_t * buffer;
+    double frequency;
+    uint32_t count, first, previous;
+    int64_t elapsed = 0;
+
+    if (argc < 2){
+        fprintf(stderr, "Uso: %s <archivo> [frecuencia en Hz]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    file = fopen(argv[1], "rb");
+    if (file == NULL){
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    rewind(file);
+    data = malloc(size);
+    if ((data == NULL) || (fread(data, 1, size, file) != (size_t) size)){
+        fprintf(stderr, "No se pudo leer %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    fclose(file);
+
+    buffer = FindBuffer(data, size);
+    if (buffer == NULL){
+        fprintf(stderr, "No se encontro un buffer de eventos en %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    frequency = (argc > 2) ? atof(argv[2]) : buffer->frequency;
+    if (frequency <= 0){
+        fprintf(stderr, "Frecuencia del contador desconocida, indiquela como segundo argumento\n");
+        return EXIT_FAILURE;
+    }
+
+    count = (buffer->head < buffer->records) ? buffer->head : buffer->records;
+    first = buffer->head - count;
+    printf("# %u registros de %u escritos, contador a %.0f Hz\n", count, buffer->head, frequency);
+    printf("#   tiempo [ms]    delta [us]  evento  argumento\n");
+
+    previous = buffer->record[first & (buffer->records - 1)].timestamp;
+    for (uint32_t index = first; index != buffer->head; index++){
+        const trace_record_t * record = &buffer->record[index & (buffer->records - 1)];
+        // Las diferencias se calculan con signo para tolerar el desborde del contador de 32 bits
+        int32_t delta = (int32_t)(record->timestamp - previous);
+
+        elapsed += delta;
+        previous = record->timestamp;
+        printf("%14.6f %13.3f  %-6s  ", 1e3 * elapsed / frequency, 1e6 * delta / frequency,
+            record->event < ELEMENTS(EVENTS) ? EVENTS[record->event] : "?");
+        PrintArgument(record);
+    }
+
+    free(data);
+    return EXIT_SUCCESS;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
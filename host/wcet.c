@@ -0,0 +1,366 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file wcet.c
+ **
+ ** @brief Peor caso y equivalencia de ClockNewTick en todos los estados de un dia
+ **
+ ** Recorre todos los ticks de un dia completo, incluido el paso a medianoche, y en
+ ** cada uno compara el reloj contra un modelo de referencia que solo cuenta ticks
+ ** desde la medianoche: hora, ticks, fecha, dia de la semana y el instante exacto
+ ** de la alarma. Despues mide cada transicion por separado, poniendo el reloj en el
+ ** estado anterior antes de cada repeticion y quedandose con la medicion minima.
+ ** Los estados mas costosos de cada tipo se vuelven a medir muchas veces para
+ ** descartar las interrupciones del host, y al final se informa el costo maximo por tipo de transicion y los estados mas costosos.
+ **
+ ** Para verificar otra implementacion del reloj se compila con
+ ** make -C host wcet WCET_CLOCK=archivo.c
+ **
+ ** Uso: wcet [ticks por segundo] [repeticiones]
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup host Compilacion en el host
+ ** @brief Peor caso del tick del reloj
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "chip.h"
+#include "clock.h"
+#include "date.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Fuente de las mediciones, en la placa se puede reemplazar por DWT->CYCCNT
+#ifndef WCET_TIMESTAMP
+    #define WCET_TIMESTAMP() HostNanoseconds()
+#endif
+
+#define WCET_DEFAULT_RATE 1000
+
+#define WCET_DEFAULT_REPETITIONS 3
+
+// Cantidad de estados mas costosos que se informan
+#define WCET_WORST 10
+
+// Estados de cada tipo de transicion que se vuelven a medir y rondas de la nueva medicion
+#define WCET_CANDIDATES 64
+
+#define WCET_CONFIRM_ROUNDS 100
+
+// Cantidad de diferencias con el modelo que se detallan antes de solo contarlas
+#define WCET_MISMATCHES 10
+
+#define SECONDS_PER_DAY 86400UL
+
+#define ELEMENTS(array) (sizeof(array) / sizeof(array[0]))
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+// Tipo de transicion segun lo que se desborda al pasar al tick siguiente
+typedef enum {
+    TRANSITION_TICK,
+    TRANSITION_SECOND,
+    TRANSITION_MINUTE,
+    TRANSITION_HOUR,
+    TRANSITION_DAY,
+    TRANSITION_TYPES,
+} transition_t;
+
+// Estado del modelo de referencia, los ticks desde la medianoche y la fecha
+struct model_s {
+    uint32_t tick;
+    uint32_t days;
+};
+
+// Costo de la transicion que sale de un estado
+struct cost_s {
+    uint32_t state;         //!< Ticks desde la medianoche antes del tick
+    uint64_t time;          //!< Menor medicion de las repeticiones, sin el costo de medir
+};
+
+/* === Definiciones de variables privadas ================================== */
+
+static const char * const TRANSITIONS[] = {
+    [TRANSITION_TICK] = "tick",
+    [TRANSITION_SECOND] = "segundo",
+    [TRANSITION_MINUTE] = "minuto",
+    [TRANSITION_HOUR] = "hora",
+    [TRANSITION_DAY] = "dia",
+};
+
+// La alarma a medianoche hace que el desborde del dia tambien dispare el evento
+static const uint8_t ALARMA[] = {0, 0, 0, 0};
+
+#define ALARM_MINUTE 0
+
+// Fecha de partida, el recorrido termina al dia siguiente
+#define START_DAYS 20745
+
+static clock_t reloj;
+
+static uint16_t rate;
+
+static uint32_t day_ticks;
+
+// Cantidad de digitos de la fraccion de segundo al imprimir un estado
+static int fraction;
+
+static volatile uint32_t alarms;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static void AlarmEvent(clock_t clock, bool state);
+
+static transition_t Transition(uint32_t state, bool * alarm);
+
+static void PrintState(uint32_t state);
+
+static uint32_t CheckEquivalence(void);
+
+static uint64_t MeasureOverhead(void);
+
+static uint64_t MeasureState(uint32_t state, uint32_t repetitions, uint64_t overhead);
+
+static void InsertWorst(struct cost_s * list, uint32_t size, struct cost_s cost);
+
+static void MeasureStates(uint32_t repetitions);
+
+/* === Definiciones de funciones privadas ================================== */
+
+static void AlarmEvent(clock_t clock, bool state){
+    (void) clock;
+    if (state) alarms++;
+}
+
+// Clasifica el tick que sale de un estado e indica si en ese tick debe sonar la alarma
+static transition_t Transition(uint32_t state, bool * alarm){
+    uint32_t next = (state + 1) % day_ticks;
+    uint32_t seconds = next / rate;
+
+    *alarm = false;
+    if (next % rate) return TRANSITION_TICK;
+    if (seconds % 60) return TRANSITION_SECOND;
+    *alarm = (seconds / 60 == ALARM_MINUTE);
+    if (seconds == 0) return TRANSITION_DAY;
+    if (seconds % 3600) return TRANSITION_MINUTE;
+    return TRANSITION_HOUR;
+}
+
+static void PrintState(uint32_t state){
+    uint32_t seconds = state / rate;
+
+    printf("%02lu:%02lu:%02lu.%0*lu", (unsigned long) (seconds / 3600), (unsigned long) (seconds / 60 % 60),
+        (unsigned long) (seconds % 60), fraction, (unsigned long) (state % rate));
+}
+
+// Avanza el reloj por todos los ticks de un dia y lo compara con el modelo despues de cada uno
+static uint32_t CheckEquivalence(void){
+    struct model_s model = {.tick = 0, .days = START_DAYS};
+    uint32_t mismatches = 0;
+
+    ClockSetupTicks(reloj, 0);
+    ClockSetupDate(reloj, START_DAYS);
+    for (uint32_t state = 0; state < day_ticks; state++){
+        uint8_t time[6];
+        uint32_t expected;
+        bool alarm;
+        bool failed;
+
+        Transition(state, &alarm);
+        alarms = 0;
+        ClockNewTick(reloj);
+
+        model.tick = (model.tick + 1) % day_ticks;
+        if (model.tick == 0) model.days++;
+        expected = model.tick / rate;
+
+        ClockGetTime(reloj, time, sizeof(time));
+        failed = (ClockGetTicks(reloj) != model.tick) || (alarms != (alarm ? 1 : 0)) ||
+            (ClockGetDate(reloj) != model.days) || (ClockGetWeekday(reloj) != DateWeekday(model.days)) ||
+            ((10U * time[0] + time[1]) != expected / 3600) || ((10U * time[2] + time[3]) != expected / 60 % 60) ||
+            ((10U * time[4] + time[5]) != expected % 60);
+
+        if (failed){
+            if (mismatches < WCET_MISMATCHES){
+                printf("diferencia al salir de ");
+                PrintState(state);
+                printf(": reloj %u%u:%u%u:%u%u ticks %lu dia %lu (%u) alarmas %lu, modelo ticks %lu dia %lu (%u) alarmas %u\n",
+                    time[0], time[1], time[2], time[3], time[4], time[5], (unsigned long) ClockGetTicks(reloj),
+                    (unsigned long) ClockGetDate(reloj), ClockGetWeekday(reloj), (unsigned long) alarms,
+                    (unsigned long) model.tick, (unsigned long) model.days, DateWeekday(model.days), alarm ? 1 : 0);
+            }
+            mismatches++;
+            /* Se vuelve a sincronizar con el modelo para que una diferencia no se propague */
+            ClockSetupTicks(reloj, model.tick);
+            ClockSetupDate(reloj, model.days);
+        }
+    }
+    return mismatches;
+}
+
+// Costo de dos lecturas seguidas de la marca de tiempo, se descuenta de cada medicion
+static uint64_t MeasureOverhead(void){
+    uint64_t best = UINT64_MAX;
+
+    for (uint32_t index = 0; index < 100000; index++){
+        uint64_t start = WCET_TIMESTAMP();
+        uint64_t elapsed = WCET_TIMESTAMP() - start;
+
+        if (elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+// Mide una transicion, el minimo de varias repeticiones descarta las interrupciones del host
+static uint64_t MeasureState(uint32_t state, uint32_t repetitions, uint64_t overhead){
+    uint64_t best = UINT64_MAX;
+
+    for (uint32_t repetition = 0; repetition < repetitions; repetition++){
+        uint64_t start;
+        uint64_t elapsed;
+
+        ClockSetupTicks(reloj, state);
+        start = WCET_TIMESTAMP();
+        ClockNewTick(reloj);
+        elapsed = WCET_TIMESTAMP() - start;
+        if (elapsed < best) best = elapsed;
+    }
+    return (best > overhead) ? best - overhead : 0;
+}
+
+// Insercion ordenada en una lista corta de los estados mas costosos
+static void InsertWorst(struct cost_s * list, uint32_t size, struct cost_s cost){
+    uint32_t position = size - 1;
+
+    if (cost.time > list[position].time){
+        while ((position > 0) && (cost.time > list[position - 1].time)){
+            list[position] = list[position - 1];
+            position--;
+        }
+        list[position] = cost;
+    }
+}
+
+/* Mide cada transicion por separado. Una interrupcion del host puede inflar todas las repeticiones
+   de un estado, por eso los candidatos de cada tipo se vuelven a medir al final con muchas mas
+   repeticiones repartidas en el tiempo antes de elegir el peor caso */
+static void MeasureStates(uint32_t repetitions){
+    static struct cost_s candidates[TRANSITION_TYPES][WCET_CANDIDATES];
+    struct cost_s worst[WCET_WORST] = {0};
+    uint32_t count[TRANSITION_TYPES] = {0};
+    uint64_t overhead = MeasureOverhead();
+
+    for (uint32_t state = 0; state < day_ticks; state++){
+        bool alarm;
+        transition_t type = Transition(state, &alarm);
+        struct cost_s cost = {.state = state, .time = MeasureState(state, repetitions, overhead)};
+
+        count[type]++;
+        InsertWorst(candidates[type], WCET_CANDIDATES, cost);
+    }
+
+    for (uint32_t round = 0; round < WCET_CONFIRM_ROUNDS; round++){
+        for (int type = 0; type < TRANSITION_TYPES; type++){
+            for (uint32_t index = 0; (index < WCET_CANDIDATES) && (index < count[type]); index++){
+                struct cost_s * cost = &candidates[type][index];
+                uint64_t time = MeasureState(cost->state, repetitions, overhead);
+
+                if ((round == 0) || (time < cost->time)) cost->time = time;
+            }
+        }
+    }
+
+    printf("\ntransicion,estados,maximo,estado_maximo\n");
+    for (int type = 0; type < TRANSITION_TYPES; type++){
+        struct cost_s maximum = {0};
+
+        for (uint32_t index = 0; (index < WCET_CANDIDATES) && (index < count[type]); index++){
+            if ((index == 0) || (candidates[type][index].time > maximum.time)) maximum = candidates[type][index];
+            InsertWorst(worst, WCET_WORST, candidates[type][index]);
+        }
+        printf("%s,%lu,%llu,", TRANSITIONS[type], (unsigned long) count[type], (unsigned long long) maximum.time);
+        PrintState(maximum.state);
+        printf("\n");
+    }
+
+    printf("\npuesto,estado,transicion,costo\n");
+    for (int position = 0; position < WCET_WORST; position++){
+        bool alarm;
+        transition_t type = Transition(worst[position].state, &alarm);
+
+        printf("%d,", position + 1);
+        PrintState(worst[position].state);
+        printf(",%s%s,%llu\n", TRANSITIONS[type], alarm ? "+alarma" : "", (unsigned long long) worst[position].time);
+    }
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+int main(int argc, char * argv[]){
+    uint32_t repetitions;
+    uint32_t mismatches;
+
+    rate = (argc > 1) ? strtoul(argv[1], NULL, 0) : WCET_DEFAULT_RATE;
+    repetitions = (argc > 2) ? strtoul(argv[2], NULL, 0) : WCET_DEFAULT_REPETITIONS;
+    if ((rate == 0) || (repetitions == 0)){
+        fprintf(stderr, "Uso: %s [ticks por segundo] [repeticiones]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    day_ticks = SECONDS_PER_DAY * rate;
+    fraction = snprintf(NULL, 0, "%u", rate - 1);
+
+    reloj = ClockCreate(rate, AlarmEvent);
+    ClockSetupAlarm(reloj, ALARMA, sizeof(ALARMA));
+
+    printf("estados: %lu a %u ticks por segundo, %lu repeticiones por estado\n", (unsigned long) day_ticks, rate,
+        (unsigned long) repetitions);
+    mismatches = CheckEquivalence();
+    printf("equivalencia con el modelo: %lu diferencias\n", (unsigned long) mismatches);
+
+    MeasureStates(repetitions);
+    return mismatches ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,128 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file ambient.h
+ **
+ ** @brief Brillo automatico segun la luz ambiente
+ **
+ ** La placa convierte el sensor de luz en forma continua y el DMA escribe los resultados en un
+ ** buffer circular, sin interrupciones por muestra. El lazo principal promedia el buffer, filtra
+ ** los promedios sucesivos y convierte la luz en un nivel con histeresis, para que la pantalla no
+ ** cambie de brillo con las variaciones pequeñas alrededor de un limite.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup ambient Luz ambiente
+ ** @brief Brillo automatico segun la luz ambiente
+ ** @{
+ */
+
+#ifndef AMBIENT_H   /*! @cond    */
+#define AMBIENT_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Valor que devuelve Value para una posicion del buffer que todavia no recibio una conversion
+#define AMBIENT_NO_SAMPLE 0xFFFF
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Referencia a un descriptor de brillo automatico
+typedef struct ambient_s * ambient_t;
+
+// Funciones del sensor de luz que implementa la placa
+typedef struct light_driver_s {
+    void (*Start)(uint32_t * buffer, uint16_t size);    //!< Inicia la conversion continua con DMA circular sobre el buffer
+    uint16_t (*Value)(uint32_t sample);                 //!< Resultado de una palabra del buffer o AMBIENT_NO_SAMPLE
+    uint16_t full_scale;                                //!< Resultado de la conversion con la luz maxima
+} const * light_driver_t;
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Crea el brillo automatico e inicia la conversion continua del sensor
+ *
+ * @param driver        Funciones del sensor de luz de la placa
+ * @param levels        Cantidad de niveles en los que se divide la escala del sensor
+ * @return ambient_t    Puntero al descriptor del brillo automatico
+ */
+ambient_t AmbientCreate(light_driver_t driver, uint8_t levels);
+
+/**
+ * @brief Promedia las muestras del buffer y recalcula el nivel, se llama desde el lazo principal
+ *
+ * @param ambient   Puntero al descriptor del brillo automatico
+ * @return true     El nivel cambio desde la llamada anterior
+ * @return false    El nivel se mantiene o todavia no hay muestras
+ */
+bool AmbientUpdate(ambient_t ambient);
+
+/**
+ * @brief Consulta el nivel de luz con histeresis
+ *
+ * @param ambient   Puntero al descriptor del brillo automatico
+ * @return uint8_t  Nivel entre cero, la oscuridad, y la cantidad de niveles menos uno
+ */
+uint8_t AmbientGetLevel(ambient_t ambient);
+
+/**
+ * @brief Consulta la luz filtrada, en unidades del conversor
+ *
+ * @param ambient   Puntero al descriptor del brillo automatico
+ * @return uint16_t Promedio filtrado de las conversiones, entre cero y el fondo de escala
+ */
+uint16_t AmbientGetLight(ambient_t ambient);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* AMBIENT_H */
@@ -0,0 +1,108 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file app.h
+ **
+ ** @brief Logica del reloj despertador
+ **
+ ** Interfaz de la maquina de estados del reloj despertador. El programa principal
+ ** de la placa y el simulador del host la ejecutan de la misma forma: AppTick desde
+ ** la interrupcion periodica y AppLoop desde el lazo principal.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup app Aplicacion
+ ** @brief Logica del reloj despertador
+ ** @{
+ */
+
+#ifndef APP_H   /*! @cond    */
+#define APP_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include "bsp.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Frecuencia con la que se debe llamar a AppTick, es la base de todos los consumidores del despachador
+#define APP_TICKS_PER_SECOND 2000
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Inicializa el reloj despertador sobre una placa ya creada
+ *
+ * @param placa     Puntero al descriptor de la placa
+ * @return true     La aplicacion quedo lista para recibir AppTick
+ * @return false    Algun consumidor no entro en el despachador, no se debe iniciar el SysTick
+ */
+bool AppInit(board_t placa);
+
+/**
+ * @brief Procesa las teclas, se llama en cada iteracion del lazo principal
+ */
+void AppLoop(void);
+
+/**
+ * @brief Despacha los eventos periodicos de la aplicacion, se llama desde la interrupcion del SysTick
+ */
+void AppTick(void);
+
+/**
+ * @brief Recupera ticks que se perdieron, se llama desde la interrupcion del SysTick antes de AppTick
+ *
+ * @param ticks Cantidad de ticks perdidos, el reloj los recibe de una sola vez
+ */
+void AppCatchUp(uint32_t ticks);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* APP_H */
@@ -0,0 +1,150 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bcd.h
+ **
+ ** @brief Aritmetica BCD empaquetada
+ **
+ ** Cada digito decimal ocupa un nibble de un entero de 32 bits, el mas significativo
+ ** en los bits altos. Las sumas y restas corrigen todos los digitos a la vez con
+ ** operaciones sobre el registro completo, sin recorrer los digitos uno por uno.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup bcd BCD empaquetado
+ ** @brief Aritmetica BCD empaquetada
+ ** @{
+ */
+
+#ifndef BCD_H   /*! @cond    */
+#define BCD_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Cantidad de digitos con los que operan las sumas y restas, el nibble superior recibe el acarreo
+#define BCD_DIGITS 7
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Numero BCD empaquetado, por ejemplo 23:59:58 se representa como 0x235958
+typedef uint32_t bcd_t;
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Empaqueta un vector de digitos BCD, el primer elemento es el mas significativo
+ *
+ * @param digits    Puntero al primer digito
+ * @param size      Cantidad de digitos, como maximo BCD_DIGITS
+ * @return bcd_t    Numero empaquetado
+ */
+bcd_t BcdPack(uint8_t const * digits, uint8_t size);
+
+/**
+ * @brief Desempaqueta los digitos menos significativos de un numero en un vector
+ *
+ * @param value     Numero empaquetado
+ * @param digits    Puntero al vector donde se escriben los digitos, el primero es el mas significativo
+ * @param size      Cantidad de digitos que se escriben
+ */
+void BcdUnpack(bcd_t value, uint8_t * digits, uint8_t size);
+
+/**
+ * @brief Suma dos numeros empaquetados
+ *
+ * @param a         Primer sumando
+ * @param b         Segundo sumando
+ * @return bcd_t    Suma, el acarreo del ultimo digito queda en el nibble superior
+ */
+bcd_t BcdAdd(bcd_t a, bcd_t b);
+
+/**
+ * @brief Resta dos numeros empaquetados
+ *
+ * @param a         Minuendo
+ * @param b         Sustraendo, no puede ser mayor que el minuendo
+ * @return bcd_t    Diferencia
+ */
+bcd_t BcdSub(bcd_t a, bcd_t b);
+
+/**
+ * @brief Suma modular, el resultado vuelve a cero al alcanzar el limite
+ *
+ * @param a         Primer sumando, menor que el limite
+ * @param b         Segundo sumando, menor que el limite
+ * @param limit     Modulo de la suma, por ejemplo 0x60 para minutos o 0x24 para horas
+ * @return bcd_t    Suma modulo el limite
+ */
+bcd_t BcdAddMod(bcd_t a, bcd_t b, bcd_t limit);
+
+/**
+ * @brief Resta modular, al pasar por debajo de cero continua desde el limite menos uno
+ *
+ * @param a         Minuendo, menor que el limite
+ * @param b         Sustraendo, menor que el limite
+ * @param limit     Modulo de la resta
+ * @return bcd_t    Diferencia modulo el limite
+ */
+bcd_t BcdSubMod(bcd_t a, bcd_t b, bcd_t limit);
+
+/**
+ * @brief Compara dos numeros empaquetados, el orden de los BCD coincide con el de los enteros
+ *
+ * @param a         Primer numero
+ * @param b         Segundo numero
+ * @return int      Negativo si a es menor, cero si son iguales y positivo si a es mayor
+ */
+int BcdCompare(bcd_t a, bcd_t b);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* BCD_H */
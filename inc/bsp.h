@@ -58,6 +58,9 @@
 #include "digital.h"
 #include "ciaa.h"
 #include "screen.h"
+#include "buzzer.h"
+#include "console.h"
+#include "ambient.h"
 
 /* === Cabecera C++ ======================================================== */
 #ifdef __cplusplus
@@ -85,12 +88,25 @@ typedef struct board_s
     digital_input_t accept;
     digital_input_t cancel;
 
-    digital_output_t buzzer;
+    digital_input_t pps;
+
+    buzzer_t buzzer;
 
     display_t display;
 
+    serial_driver_t serial;
+
+    light_driver_t light;
+
 } const * board_t;
 
+// Estadisticas de las interrupciones del SysTick que llegaron tarde
+typedef struct sistick_stats_s {
+    uint32_t overruns;      //!< Interrupciones que se atendieron con uno o mas ticks perdidos
+    uint32_t lost;          //!< Total de ticks perdidos y recuperados
+    uint32_t max_lateness;  //!< Maximo retraso observado respecto del momento esperado, en ciclos del nucleo
+} * sistick_stats_t;
+
 /* === Declaraciones de variables publicas ================================= */
 
 /* === Declaraciones de funciones publicas ================================= */
@@ -99,6 +115,20 @@ board_t BoardCreate(void);
 
 void SisTick_Init(uint16_t ticks);
 
+/**
+ * @brief Compara el contador de ciclos con el momento esperado del tick, se llama al comienzo del SysTick_Handler
+ *
+ * @return uint32_t Cantidad de ticks que se perdieron antes del actual, cero si la interrupcion llego a tiempo
+ */
+uint32_t SisTick_Lost(void);
+
+/**
+ * @brief Obtiene las estadisticas de las interrupciones del SysTick que llegaron tarde
+ *
+ * @param stats Puntero a la estructura donde se copian las estadisticas
+ */
+void SisTick_GetStats(sistick_stats_t stats);
+
 /* === Ciere de documentacion ============================================== */
 #ifdef __cplusplus
 }
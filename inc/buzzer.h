@@ -0,0 +1,138 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file buzzer.h
+ **
+ ** @brief Zumbador de la alarma con tono generado por hardware
+ **
+ ** El tono lo genera una salida de un temporizador sin intervencion del procesador.
+ ** Este modulo solo recorre a baja frecuencia una tabla de pasos con la cadencia de
+ ** los pitidos y sube el volumen cada cierta cantidad de repeticiones.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup buzzer Zumbador
+ ** @brief Zumbador de la alarma
+ ** @{
+ */
+
+#ifndef BUZZER_H   /*! @cond    */
+#define BUZZER_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Frecuencia en Hz con la que se debe llamar a BuzzerTick, fija la resolucion de la cadencia
+#ifndef BUZZER_TICK_RATE
+    #define BUZZER_TICK_RATE 50
+#endif
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Referencia a un descriptor del zumbador
+typedef struct buzzer_s * buzzer_t;
+
+// Funcion del driver que programa el tono, con frecuencia o volumen en cero el zumbador queda en silencio
+typedef void (*buzzer_tone_set_t)(uint16_t frequency, uint8_t volume);
+
+typedef struct buzzer_driver_s {
+    buzzer_tone_set_t ToneSet;
+} const * buzzer_driver_t;
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Crea el zumbador y lo deja en silencio
+ *
+ * @param driver        Funciones de la placa que generan el tono
+ * @return buzzer_t     Puntero al descriptor del zumbador
+ */
+buzzer_t BuzzerCreate(buzzer_driver_t driver);
+
+/**
+ * @brief Comienza a sonar desde el primer paso de la cadencia y con el volumen minimo
+ *
+ * Solo deja el pedido, la cadencia empieza en la proxima llamada a BuzzerTick. Se puede llamar
+ * desde la interrupcion o desde el lazo principal
+ *
+ * @param buzzer    Puntero al descriptor del zumbador
+ */
+void BuzzerStart(buzzer_t buzzer);
+
+/**
+ * @brief Silencia el zumbador y descarta un pedido de BuzzerStart que no se atendio
+ *
+ * @param buzzer    Puntero al descriptor del zumbador
+ */
+void BuzzerStop(buzzer_t buzzer);
+
+/**
+ * @brief Consulta si el zumbador esta sonando
+ *
+ * @param buzzer    Puntero al descriptor del zumbador
+ * @return true     El zumbador esta recorriendo la cadencia
+ * @return false    El zumbador esta en silencio
+ */
+bool BuzzerIsRinging(buzzer_t buzzer);
+
+/**
+ * @brief Avanza la cadencia, se debe llamar con la frecuencia BUZZER_TICK_RATE
+ *
+ * Solo se llama al driver cuando cambia el paso, entre pasos no se accede al hardware
+ *
+ * @param buzzer    Puntero al descriptor del zumbador
+ */
+void BuzzerTick(buzzer_t buzzer);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* BUZZER_H */
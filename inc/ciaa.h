@@ -98,6 +98,67 @@ extern "C" {
 #define LED_3_GPIO 1
 #define LED_3_BIT 12
 
+// Entrada GPIO0 de la placa, recibe el pulso por segundo de una referencia externa
+#define PPS_PORT 6
+#define PPS_PIN 1
+#define PPS_FUNC SCU_MODE_FUNC0
+#define PPS_GPIO 3
+#define PPS_BIT 0
+
+// Puerto serie conectado al conversor USB de la placa
+#define UART_USB LPC_USART2
+#define UART_USB_BAUDRATE 115200
+
+#define UART_USB_TXD_PORT 7
+#define UART_USB_TXD_PIN 1
+#define UART_USB_TXD_FUNC SCU_MODE_FUNC6
+
+#define UART_USB_RXD_PORT 7
+#define UART_USB_RXD_PIN 2
+#define UART_USB_RXD_FUNC SCU_MODE_FUNC6
+
+#define UART_USB_DMA_TX GPDMA_CONN_UART2_Tx
+#define UART_USB_DMA_RX GPDMA_CONN_UART2_Rx
+
+// Conector SPI de la placa, alimenta la cadena de registros de desplazamiento de la pantalla
+#define SPI_SSP LPC_SSP1
+#define SPI_BITRATE 10000000
+
+#define SPI_MOSI_PORT 1
+#define SPI_MOSI_PIN 4
+#define SPI_MOSI_FUNC SCU_MODE_FUNC5
+
+#define SPI_SCK_PORT 0xF
+#define SPI_SCK_PIN 4
+#define SPI_SCK_FUNC SCU_MODE_FUNC0
+
+// Seleccion manejada por el SSP, con CPHA en cero se libera entre palabras y sirve de carga (LOAD)
+#define SPI_SSEL_PORT 1
+#define SPI_SSEL_PIN 5
+#define SPI_SSEL_FUNC SCU_MODE_FUNC5
+
+#define SPI_DMA_TX GPDMA_CONN_SSP1_Tx
+
+// Entrada GPIO1 de la placa, usada como carga (RCLK) de los registros de desplazamiento
+#define SHIFT_LATCH_PORT 6
+#define SHIFT_LATCH_PIN 4
+#define SHIFT_LATCH_FUNC SCU_MODE_FUNC0
+#define SHIFT_LATCH_GPIO 3
+#define SHIFT_LATCH_BIT 3
+
+// Entrada GPIO2 de la placa, conectada a la habilitacion (OE) de los registros, en alto apaga las salidas
+#define SHIFT_BLANK_PORT 6
+#define SHIFT_BLANK_PIN 5
+#define SHIFT_BLANK_FUNC SCU_MODE_FUNC0
+#define SHIFT_BLANK_GPIO 3
+#define SHIFT_BLANK_BIT 4
+
+// Entrada analogica CH1 de la placa, conectada al sensor de luz ambiente, es un terminal dedicado del ADC
+#define LIGHT_ADC LPC_ADC0
+#define LIGHT_CHANNEL ADC_CH1
+#define LIGHT_SAMPLE_RATE 10000
+#define LIGHT_DMA GPDMA_CONN_ADC_0
+
 /* == Declaraciones de tipos de datos publicos ============================= */
 
 /* === Declaraciones de variables publicas ================================= */
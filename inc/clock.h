@@ -1,8 +1,12 @@
 #include <stdint.h>
 #include<stdbool.h>
+#include "date.h"
 
 typedef struct clock_s * clock_t;
 
+// Vista de un reloj con otra zona horaria, no recibe ticks propios
+typedef struct clock_view_s * clock_view_t;
+
 typedef void (*clock_event_t)(clock_t clock, bool state);
 
 clock_t ClockCreate(uint16_t ticks_per_second, clock_event_t event_handler);
@@ -11,12 +15,54 @@ bool ClockGetTime(clock_t clock, uint8_t * time, uint8_t size);
 
 void ClockSetupTime(clock_t clock, uint8_t const * const time, uint8_t size);
 
+// Hora actual como ticks desde la medianoche, incluye la fraccion del segundo en curso
+uint32_t ClockGetTicks(clock_t clock);
+
+// Ajusta la hora de golpe a una cantidad de ticks desde la medianoche
+void ClockSetupTicks(clock_t clock, uint32_t ticks);
+
+// Suma una correccion en ticks que se aplica alargando o acortando los proximos segundos, positiva adelanta
+void ClockSlew(clock_t clock, int32_t ticks);
+
+// Correccion en ticks que todavia no se aplico
+int32_t ClockGetSlew(clock_t clock);
+
+// Corrige la frecuencia del reloj en partes por millon, positiva adelanta
+void ClockTrim(clock_t clock, int32_t ppm);
+
 void ClockNewTick(clock_t clock);
 
+void ClockAdvance(clock_t clock, uint32_t ticks);
+
 void ClockSetupAlarm(clock_t clock, uint8_t const * const alarm, uint8_t size);
 
 bool ClockGetAlarm(clock_t clock, uint8_t * alarm, uint8_t size);
 
+void ClockSetupDate(clock_t clock, uint32_t days);
+
+uint32_t ClockGetDate(clock_t clock);
+
+uint8_t ClockGetWeekday(clock_t clock);
+
+void ClockSetupAlarmDays(clock_t clock, uint8_t weekdays);
+
+uint8_t ClockGetAlarmDays(clock_t clock);
+
 bool ClockToggleAlarm(clock_t clock);
 
 void ClockPostponeAlarm(clock_t clock, uint8_t const * const postPone_alarm, uint8_t size);
+
+// Crea una vista desplazada en minutos respecto del reloj, devuelve NULL si no quedan vistas libres
+clock_view_t ClockViewCreate(clock_t clock, int16_t minutes);
+
+void ClockViewSetOffset(clock_view_t view, int16_t minutes);
+
+int16_t ClockViewGetOffset(clock_view_t view);
+
+// Hora de la vista con el mismo formato que ClockGetTime, es valida si lo es la del reloj
+bool ClockViewGetTime(clock_view_t view, uint8_t * time, uint8_t size);
+
+// Fecha de la vista, puede diferir en un dia de la del reloj
+uint32_t ClockViewGetDate(clock_view_t view);
+
+uint8_t ClockViewGetWeekday(clock_view_t view);
@@ -0,0 +1,161 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file console.h
+ **
+ ** @brief Consola de comandos sobre un puerto serie con DMA
+ **
+ ** La recepcion y la transmision usan buffers circulares que mueve el DMA, el
+ ** procesador no atiende una interrupcion por byte. Las lineas se interpretan
+ ** directamente sobre el buffer de recepcion, sin copiarlas.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup console Consola
+ ** @brief Consola de comandos serie
+ ** @{
+ */
+
+#ifndef CONSOLE_H   /*! @cond    */
+#define CONSOLE_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Cantidad maxima de valores numericos que recibe un comando
+#define CONSOLE_VALUES 4
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Referencia a una consola de comandos
+typedef struct console_s * console_t;
+
+// Funciones del puerto serie que implementa la placa
+typedef struct serial_driver_s {
+    void (*Start)(uint8_t * buffer, uint16_t size);         //!< Inicia la recepcion circular por DMA sobre el buffer
+    uint16_t (*Received)(void);                             //!< Posicion del buffer en la que el DMA escribira el proximo byte
+    void (*Send)(uint8_t const * data, uint16_t size);      //!< Inicia la transmision por DMA de un bloque contiguo
+    bool (*Sending)(void);                                  //!< La ultima transmision todavia no termino
+} const * serial_driver_t;
+
+// Funcion que ejecuta un comando con los valores numericos de la linea
+typedef void (*console_handler_t)(console_t console, uint8_t count, uint32_t const * values);
+
+// Comando de la consola
+typedef struct console_command_s {
+    const char * name;          //!< Nombre con el que se invoca el comando
+    const char * help;          //!< Descripcion que muestra el comando ayuda
+    console_handler_t handler;
+} const * console_command_t;
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Crea la consola e inicia la recepcion
+ *
+ * @param driver        Funciones del puerto serie de la placa
+ * @param commands      Tabla de comandos, el comando ayuda se agrega siempre
+ * @param count         Cantidad de comandos de la tabla
+ * @return console_t    Puntero al descriptor de la consola
+ */
+console_t ConsoleCreate(serial_driver_t driver, console_command_t commands, uint8_t count);
+
+/**
+ * @brief Procesa las lineas recibidas y continua la transmision, se llama desde el lazo principal
+ *
+ * @param console   Puntero al descriptor de la consola
+ */
+void ConsolePoll(console_t console);
+
+/**
+ * @brief Encola datos para transmitir, no bloquea
+ *
+ * @param console   Puntero al descriptor de la consola
+ * @param data      Datos a transmitir
+ * @param size      Cantidad de bytes
+ * @return true     Los datos se encolaron completos
+ * @return false    No habia lugar y no se encolo nada
+ */
+bool ConsoleWrite(console_t console, uint8_t const * data, uint16_t size);
+
+/**
+ * @brief Encola un texto terminado en cero para transmitir
+ *
+ * @param console   Puntero al descriptor de la consola
+ * @param text      Texto a transmitir
+ * @return true     El texto se encolo completo
+ * @return false    No habia lugar y no se encolo nada
+ */
+bool ConsolePrint(console_t console, const char * text);
+
+/**
+ * @brief Encola un numero en decimal completado con ceros a la izquierda
+ *
+ * @param console   Puntero al descriptor de la consola
+ * @param value     Numero a transmitir
+ * @param digits    Cantidad minima de digitos
+ * @return true     El numero se encolo completo
+ * @return false    No habia lugar y no se encolo nada
+ */
+bool ConsolePrintNumber(console_t console, uint32_t value, uint8_t digits);
+
+/**
+ * @brief Consulta el lugar libre para transmitir
+ *
+ * @param console       Puntero al descriptor de la consola
+ * @return uint16_t     Cantidad de bytes que se pueden encolar
+ */
+uint16_t ConsoleFree(console_t console);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* CONSOLE_H */
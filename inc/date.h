@@ -0,0 +1,138 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file date.h
+ **
+ ** @brief Fechas del calendario como cantidad de dias
+ **
+ ** Las fechas se guardan como dias transcurridos desde el 1 de enero de 1970, asi
+ ** avanzar un dia es un incremento y las conversiones al calendario civil se hacen
+ ** con una cantidad fija de operaciones, sin recorrer meses ni años.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup date Fechas
+ ** @brief Fechas del calendario
+ ** @{
+ */
+
+#ifndef DATE_H   /*! @cond    */
+#define DATE_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Dias de la semana, el 1 de enero de 1970 fue jueves
+#define DATE_SUNDAY     0
+#define DATE_MONDAY     1
+#define DATE_TUESDAY    2
+#define DATE_WEDNESDAY  3
+#define DATE_THURSDAY   4
+#define DATE_FRIDAY     5
+#define DATE_SATURDAY   6
+
+// Mascaras de dias de la semana para las alarmas
+#define DATE_WEEKDAY_MASK(weekday) (1 << (weekday))
+
+#define DATE_WORKDAYS (DATE_WEEKDAY_MASK(DATE_MONDAY) | DATE_WEEKDAY_MASK(DATE_TUESDAY) | \
+    DATE_WEEKDAY_MASK(DATE_WEDNESDAY) | DATE_WEEKDAY_MASK(DATE_THURSDAY) | DATE_WEEKDAY_MASK(DATE_FRIDAY))
+
+#define DATE_WEEKEND (DATE_WEEKDAY_MASK(DATE_SATURDAY) | DATE_WEEKDAY_MASK(DATE_SUNDAY))
+
+#define DATE_EVERY_DAY (DATE_WORKDAYS | DATE_WEEKEND)
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Fecha del calendario civil
+typedef struct date_s {
+    uint16_t year;
+    uint8_t month;      //!< Mes, de 1 a 12
+    uint8_t day;        //!< Dia del mes, de 1 a 31
+} * date_t;
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Convierte una cantidad de dias desde el 1 de enero de 1970 en una fecha del calendario
+ *
+ * @param days      Dias transcurridos desde el 1 de enero de 1970
+ * @param date      Puntero a la fecha donde se devuelve el resultado
+ */
+void DateFromDays(uint32_t days, date_t date);
+
+/**
+ * @brief Convierte una fecha del calendario en la cantidad de dias desde el 1 de enero de 1970
+ *
+ * @param date          Puntero a la fecha, debe ser posterior al 1 de enero de 1970
+ * @return uint32_t     Dias transcurridos desde el 1 de enero de 1970
+ */
+uint32_t DateToDays(struct date_s const * date);
+
+/**
+ * @brief Calcula el dia de la semana de una fecha
+ *
+ * @param days          Dias transcurridos desde el 1 de enero de 1970
+ * @return uint8_t      Dia de la semana, entre DATE_SUNDAY y DATE_SATURDAY
+ */
+uint8_t DateWeekday(uint32_t days);
+
+/**
+ * @brief Calcula la cantidad de dias de un mes, teniendo en cuenta los años bisiestos
+ *
+ * @param year          Año del calendario gregoriano
+ * @param month         Mes, de 1 a 12
+ * @return uint8_t      Dias del mes, o cero si el mes no es valido
+ */
+uint8_t DateDaysInMonth(uint16_t year, uint8_t month);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* DATE_H */
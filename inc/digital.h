@@ -78,17 +78,29 @@ typedef struct digital_input_s * digital_input_t;
 
 /* === Declaraciones de funciones publicas ================================= */
 
+// La placa configura el sentido y el estado inicial de los terminales, crear el descriptor no accede al hardware
 digital_output_t DigitalOutputCreate( uint8_t gpio, uint8_t bit);
 void DigitalOutputActivate( digital_output_t output );
 void DigitalOutputDeactivate( digital_output_t output);
 void DigitalOutputToggle( digital_output_t output);
 
 digital_input_t DigitalInputCreate( uint8_t gpio, uint8_t bit, bool inverted);
+// Estado de la entrada, ya filtrado si la entrada tiene antirrebote
 bool DigitalInputGetState(digital_input_t input);
+// Estado del terminal sin filtrar, para medir el momento real de los flancos
+bool DigitalInputGetRawState(digital_input_t input);
 bool DigitalInputHasChanged(digital_input_t input);
 bool DigitalInputHasActivated(digital_input_t input);
 bool DigitalInputHasDeactivated(digital_input_t input);
 
+// Detecta la activacion y genera repeticiones aceleradas mientras la entrada se mantiene activa,
+// now es la marca de tiempo actual en ticks del sistema
+bool DigitalInputHasRepeated(digital_input_t input, uint32_t now);
+
+// Filtra los rebotes, se llama periodicamente desde la interrupcion. Desde la primera llamada el
+// estado de la entrada solo cambia cuando el terminal se mantiene igual DIGITAL_DEBOUNCE_SAMPLES veces
+void DigitalInputDebounce(digital_input_t input);
+
 /* === Ciere de documentacion ============================================== */
 #ifdef __cplusplus
 }
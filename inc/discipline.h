@@ -0,0 +1,149 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file discipline.h
+ **
+ ** @brief Disciplina de la hora contra una referencia externa
+ **
+ ** Recibe marcas de tiempo de una referencia, la hora completa desde la consola o un
+ ** pulso por segundo en una entrada, estima el desfase y el error de frecuencia del
+ ** reloj local y los corrige estirando o acortando los segundos. La hora converge sin
+ ** saltos, salvo cuando el desfase es tan grande que conviene ajustarla de golpe.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup discipline Disciplina
+ ** @brief Correccion de la hora sin saltos
+ ** @{
+ */
+
+#ifndef DISCIPLINE_H   /*! @cond    */
+#define DISCIPLINE_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+#include "clock.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Referencia a un descriptor de la disciplina
+typedef struct discipline_s * discipline_t;
+
+// Estado del reloj capturado en el instante de una referencia
+typedef struct discipline_sample_s {
+    uint32_t ticks;     //!< Hora local en ticks desde la medianoche
+    int32_t slew;       //!< Correccion que el reloj todavia no habia aplicado
+} * discipline_sample_t;
+
+// Resultado de la ultima correccion, para mostrar por la consola
+typedef struct discipline_status_s {
+    int32_t offset;     //!< Ultimo desfase medido en ticks, positivo si el reloj local atrasa
+    int32_t frequency;  //!< Correccion de frecuencia aplicada en partes por millon
+    uint32_t updates;   //!< Referencias procesadas
+    uint32_t steps;     //!< Veces que la hora se ajusto de golpe
+} * discipline_status_t;
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Crea la disciplina de un reloj, sin correccion de frecuencia
+ *
+ * @param clock             Reloj que se corrige
+ * @param ticks_per_second  Ticks por segundo con los que se creo el reloj
+ * @return discipline_t     Puntero al descriptor de la disciplina
+ */
+discipline_t DisciplineCreate(clock_t clock, uint16_t ticks_per_second);
+
+/**
+ * @brief Captura el estado del reloj, se llama en el instante exacto de la referencia
+ *
+ * Es la unica funcion pensada para la interrupcion, el procesamiento de la muestra
+ * se hace despues desde el lazo principal.
+ *
+ * @param discipline    Puntero al descriptor de la disciplina
+ * @param sample        Muestra donde se guarda el estado del reloj
+ */
+void DisciplineCapture(discipline_t discipline, discipline_sample_t sample);
+
+/**
+ * @brief Procesa una referencia con la hora completa, como la ingresada por la consola
+ *
+ * Solo corrige la fase, su resolucion de un segundo no alcanza para estimar la frecuencia.
+ * Si el reloj no tenia hora o el desfase supera DISCIPLINE_STEP_LIMIT la hora se ajusta de golpe.
+ *
+ * @param discipline    Puntero al descriptor de la disciplina
+ * @param seconds       Segundos desde la medianoche de la referencia
+ * @param sample        Estado del reloj capturado al recibir la referencia
+ */
+void DisciplineReference(discipline_t discipline, uint32_t seconds, discipline_sample_t const sample);
+
+/**
+ * @brief Procesa un pulso que marca el comienzo de un segundo de la referencia
+ *
+ * El pulso se asocia al segundo local mas cercano, por lo que la hora debe estar
+ * previamente ajustada con un error menor a medio segundo. Se ignora si el reloj no tiene hora.
+ *
+ * @param discipline    Puntero al descriptor de la disciplina
+ * @param sample        Estado del reloj capturado en el flanco del pulso
+ */
+void DisciplinePulse(discipline_t discipline, discipline_sample_t const sample);
+
+/**
+ * @brief Consulta el resultado de la ultima correccion
+ *
+ * @param discipline    Puntero al descriptor de la disciplina
+ * @param status        Estructura donde se copia el estado
+ */
+void DisciplineGetStatus(discipline_t discipline, discipline_status_t status);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* DISCIPLINE_H */
@@ -0,0 +1,171 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file latency.h
+ **
+ ** @brief Medicion de la demora entre una tecla y la pantalla
+ **
+ ** Toma la marca de tiempo del flanco de cada tecla muestreando los terminales desde
+ ** la interrupcion y la compara con el momento en que el primer cuadro publicado
+ ** despues de atender la tecla llega a DisplayRefresh. Las demoras se acumulan en un
+ ** histograma por tecla y por modo de la aplicacion.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup latency Latencia
+ ** @brief Demora de punta a punta de las teclas
+ ** @{
+ */
+
+#ifndef LATENCY_H   /*! @cond    */
+#define LATENCY_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Cantidad de teclas que se miden
+#ifndef LATENCY_KEYS
+    #define LATENCY_KEYS 6
+#endif
+
+// Cantidad de modos de la aplicacion que se distinguen
+#ifndef LATENCY_MODES
+    #define LATENCY_MODES 8
+#endif
+
+// Intervalos del histograma, el primero es menor a un milisegundo y cada uno duplica al anterior
+#define LATENCY_BUCKETS 8
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Referencia a un descriptor de la medicion
+typedef struct latency_s * latency_t;
+
+// Demoras acumuladas de una tecla en un modo
+typedef struct latency_histogram_s {
+    uint16_t bucket[LATENCY_BUCKETS];   //!< Cantidad de mediciones en cada intervalo
+    uint16_t count;                     //!< Cantidad total de mediciones
+    uint32_t total;                     //!< Suma de las demoras en microsegundos, para el promedio
+    uint32_t max;                       //!< Demora maxima en microsegundos
+} const * latency_histogram_t;
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Crea la medicion con todos los histogramas vacios
+ *
+ * @return latency_t    Puntero al descriptor de la medicion
+ */
+latency_t LatencyCreate(void);
+
+/**
+ * @brief Muestrea el estado crudo de una tecla, se llama periodicamente desde la interrupcion
+ *
+ * Un flanco de activacion comienza una medicion si la tecla no tiene otra en curso, y si la
+ * tecla se suelta antes de que el lazo principal la atienda la medicion se descarta
+ *
+ * @param latency   Puntero al descriptor de la medicion
+ * @param key       Numero de la tecla
+ * @param state     Estado actual del terminal, verdadero si esta presionada
+ */
+void LatencySample(latency_t latency, uint8_t key, bool state);
+
+/**
+ * @brief Informa que el lazo principal atendio la tecla, se llama desde el lazo principal
+ *
+ * @param latency   Puntero al descriptor de la medicion
+ * @param key       Numero de la tecla
+ * @param mode      Modo en el que estaba la aplicacion al atender la tecla
+ */
+void LatencyHandled(latency_t latency, uint8_t key, uint8_t mode);
+
+/**
+ * @brief Informa el cuadro publicado despues de atender las teclas, se llama despues de DisplayCommit
+ *
+ * @param latency   Puntero al descriptor de la medicion
+ * @param frame     Numero de publicacion devuelto por DisplayGetFrame
+ */
+void LatencyCommitted(latency_t latency, uint32_t frame);
+
+/**
+ * @brief Informa el cuadro que llego a la pantalla, se llama despues de cada DisplayRefresh
+ *
+ * Cierra las mediciones que esperaban ese cuadro o uno anterior
+ *
+ * @param latency   Puntero al descriptor de la medicion
+ * @param frame     Numero de publicacion devuelto por DisplayGetShownFrame
+ */
+void LatencyShown(latency_t latency, uint32_t frame);
+
+/**
+ * @brief Consulta el histograma de una tecla en un modo
+ *
+ * @param latency               Puntero al descriptor de la medicion
+ * @param key                   Numero de la tecla
+ * @param mode                  Modo de la aplicacion
+ * @return latency_histogram_t  Histograma acumulado, se sigue actualizando desde la interrupcion
+ */
+latency_histogram_t LatencyGetHistogram(latency_t latency, uint8_t key, uint8_t mode);
+
+/**
+ * @brief Vacia todos los histogramas
+ *
+ * El borrado se pide desde el lazo principal y se hace en la proxima llamada a LatencyShown,
+ * dentro de la interrupcion que es la unica que escribe los histogramas
+ *
+ * @param latency   Puntero al descriptor de la medicion
+ */
+void LatencyClear(latency_t latency);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* LATENCY_H */
@@ -0,0 +1,145 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file max7219.h
+ **
+ ** @brief Registros de los controladores de pantalla MAX7219
+ **
+ ** Definiciones comunes a la placa y a las herramientas del host para hablar con un
+ ** controlador de siete segmentos que multiplexa por su cuenta. Cada escritura es una
+ ** palabra de 16 bits con la direccion del registro en el byte alto y el dato en el bajo.
+ ** El armado de las palabras tambien es comun, cada placa solo entrega la funcion que las
+ ** envia por el bus.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup max7219 Controlador de pantalla
+ ** @brief Controlador MAX7219
+ ** @{
+ */
+
+#ifndef MAX7219_H   /*! @cond    */
+#define MAX7219_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Cantidad de digitos que multiplexa un controlador
+#define MAX7219_DIGITS 8
+
+// Direcciones de los registros
+#define MAX7219_NOOP 0x00
+#define MAX7219_DIGIT(digit) (0x01 + (digit))
+#define MAX7219_DECODE_MODE 0x09
+#define MAX7219_INTENSITY 0x0A
+#define MAX7219_SCAN_LIMIT 0x0B
+#define MAX7219_SHUTDOWN 0x0C
+#define MAX7219_DISPLAY_TEST 0x0F
+
+#define MAX7219_REGISTERS 16
+
+// Palabra que escribe un dato en un registro
+#define MAX7219_WORD(address, data) ((uint16_t) (((address) << 8) | (data)))
+
+// En los registros de digito el punto es el bit 7 y los segmentos A a G van del bit 6 al bit 0
+#define MAX7219_SEGMENT_BIT(segment) (((segment) == 7) ? 0x80 : (0x40 >> (segment)))
+
+// Mayor rafaga que envian Max7219Write y Max7219SetBrightness, solo Max7219Clear la supera
+#define MAX7219_BURST MAX7219_DIGITS
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Referencia a un controlador de pantalla
+typedef struct max7219_s * max7219_t;
+
+// Funcion de la placa que envia una rafaga de palabras por el bus
+typedef void (*max7219_send_t)(uint16_t const * words, uint8_t count);
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Crea el descriptor de un controlador, no envia nada por el bus
+ *
+ * @param digits        Cantidad de digitos conectados, hasta MAX7219_DIGITS
+ * @param send          Funcion que envia las palabras al controlador
+ * @return max7219_t    Puntero al descriptor del controlador
+ */
+max7219_t Max7219Create(uint8_t digits, max7219_send_t send);
+
+/**
+ * @brief Configura el controlador y apaga todos los digitos
+ *
+ * Envia cinco palabras de configuracion mas una por digito, se usa solo al iniciar la pantalla
+ *
+ * @param controller    Puntero al descriptor del controlador
+ */
+void Max7219Clear(max7219_t controller);
+
+/**
+ * @brief Envia en una sola rafaga los registros de digito que cambiaron desde la ultima escritura
+ *
+ * @param controller    Puntero al descriptor del controlador
+ * @param segments      Segmentos de cada digito, con el punto en el bit 7
+ * @param digits        Cantidad de digitos
+ */
+void Max7219Write(max7219_t controller, uint8_t const * segments, uint8_t digits);
+
+/**
+ * @brief Fija la intensidad del controlador
+ *
+ * @param controller    Puntero al descriptor del controlador
+ * @param level         Nivel de brillo, entre cero y DISPLAY_BRIGHTNESS_LEVELS - 1
+ */
+void Max7219SetBrightness(max7219_t controller, uint8_t level);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* MAX7219_H */
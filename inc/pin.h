@@ -0,0 +1,143 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file pin.h
+ **
+ ** @brief Acceso directo a terminales conocidos al compilar
+ **
+ ** Funciones en linea para los terminales cuyo puerto y bit son constantes del programa.
+ ** Cada operacion se reduce a una unica escritura o lectura de los registros de byte y de
+ ** inversion del GPIO, sin llamadas ni descriptores. Las macros reciben el prefijo de las
+ ** definiciones _GPIO y _BIT de ciaa.h y poncho.h, por ejemplo PIN_ACTIVATE(LED_R). Los
+ ** terminales que se eligen en tiempo de ejecucion siguen usando los descriptores de digital.h.
+ ** La tabla con todos los terminales de la placa esta en pin.c y se configura con PinsInit.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup pin Terminales
+ ** @brief Acceso directo a terminales
+ ** @{
+ */
+
+#ifndef PIN_H   /*! @cond    */
+#define PIN_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include "chip.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Escritura del nivel de un terminal, el host la redefine para contar los accesos
+#ifndef PIN_STORE
+    #define PIN_STORE(gpio, bit, state) (LPC_GPIO_PORT->B[gpio][bit] = (state))
+#endif
+
+// Inversion del nivel de un terminal en una sola escritura, sin leer el estado anterior
+#ifndef PIN_INVERT
+    #define PIN_INVERT(gpio, bit) (LPC_GPIO_PORT->NOT[gpio] = 1UL << (bit))
+#endif
+
+#define PIN_ACTIVATE(pin)       PinWrite(pin##_GPIO, pin##_BIT, true)
+
+#define PIN_DEACTIVATE(pin)     PinWrite(pin##_GPIO, pin##_BIT, false)
+
+#define PIN_WRITE(pin, state)   PinWrite(pin##_GPIO, pin##_BIT, state)
+
+#define PIN_TOGGLE(pin)         PinToggle(pin##_GPIO, pin##_BIT)
+
+#define PIN_READ(pin)           PinRead(pin##_GPIO, pin##_BIT)
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Configura la funcion, el modo y el sentido de todos los terminales que usa la placa
+ *
+ * Las salidas de GPIO quedan apagadas antes de habilitarlas
+ */
+void PinsInit(void);
+
+/**
+ * @brief Fija el nivel de un terminal de salida
+ *
+ * @param gpio  Puerto de GPIO del terminal
+ * @param bit   Bit del terminal dentro del puerto
+ * @param state Nivel que se escribe en el terminal
+ */
+static inline void PinWrite(uint8_t gpio, uint8_t bit, bool state){
+    PIN_STORE(gpio, bit, state);
+}
+
+/**
+ * @brief Invierte el nivel de un terminal de salida
+ *
+ * @param gpio  Puerto de GPIO del terminal
+ * @param bit   Bit del terminal dentro del puerto
+ */
+static inline void PinToggle(uint8_t gpio, uint8_t bit){
+    PIN_INVERT(gpio, bit);
+}
+
+/**
+ * @brief Lee el nivel de un terminal
+ *
+ * @param gpio  Puerto de GPIO del terminal
+ * @param bit   Bit del terminal dentro del puerto
+ * @return true El terminal esta en nivel alto
+ */
+static inline bool PinRead(uint8_t gpio, uint8_t bit){
+    return LPC_GPIO_PORT->B[gpio][bit] != 0;
+}
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* PIN_H */
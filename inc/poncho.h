@@ -203,6 +203,11 @@ extern "C"
 #define BUZZER_GPIO 5
 #define BUZZER_BIT 2
 
+// Salida del SCT que genera el tono del zumbador y funcion del terminal que la conecta
+#define BUZZER_PWM_FUNC SCU_MODE_FUNC1
+#define BUZZER_SCT_OUT 6
+#define BUZZER_SCT_INDEX 1
+
 /* == Declaraciones de tipos de datos publicos ============================= */
 
 /* === Declaraciones de variables publicas ================================= */
@@ -0,0 +1,160 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file record.h
+ **
+ ** @brief Grabacion de sesiones de uso para reproducirlas en el host
+ **
+ ** Guarda en un buffer en RAM los flancos de las teclas, los ticks perdidos, las vueltas
+ ** del lazo principal y los cuadros que llegan a la pantalla junto con el estado del reloj,
+ ** con la marca de tiempo en ticks de la aplicacion. El buffer se vuelca a un archivo, o
+ ** desde la placa con gdb, y el programa replay del host alimenta la misma secuencia a la
+ ** aplicacion y compara los resultados. Las vueltas del lazo se agrupan en tramos de
+ ** periodo constante para que el lazo libre de la placa no llene el buffer en segundos.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup record Grabacion
+ ** @brief Grabacion de sesiones de uso
+ ** @{
+ */
+
+#ifndef RECORD_H   /*! @cond    */
+#define RECORD_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Cantidad de registros del buffer, al llenarse la grabacion se detiene para conservar el comienzo
+#ifndef RECORD_ENTRIES
+    #define RECORD_ENTRIES 1024
+#endif
+
+// Identificador del buffer para localizarlo dentro de un volcado de memoria ("REC3")
+#define RECORD_MAGIC 0x33434552
+
+// La grabacion se detuvo porque el buffer se lleno
+#define RECORD_FLAG_FULL 0x0001
+
+// Durante la grabacion hubo entradas que no se graban, comandos de la consola o el pulso de referencia
+#define RECORD_FLAG_UNRECORDED 0x0002
+
+// Banderas del estado del reloj en los registros RECORD_CLOCK
+#define RECORD_CLOCK_VALID 0x01
+
+#define RECORD_CLOCK_ALARM 0x02
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Tipos de registro
+typedef enum {
+    RECORD_WAIT,        //!< Espera larga, valor: ticks que no entraron en el campo delta
+    RECORD_KEY,         //!< Flanco de una tecla, argumento: tecla de trace_key_t, valor: 1 presionada
+    RECORD_LOST,        //!< Ticks perdidos recuperados, valor: cantidad de ticks
+    RECORD_FRAME,       //!< Cuadro que llego a la pantalla, valor: segmentos de los cuatro digitos
+    RECORD_CLOCK,       //!< Estado del reloj al mostrar el cuadro, argumento: banderas, valor: hora 0xHHMMSS
+    RECORD_LOOP,        //!< Tramo de vueltas del lazo principal, argumento: ticks entre vueltas, valor: vueltas
+} record_kind_t;
+
+// Registro individual, ocupa ocho bytes
+typedef struct record_entry_s {
+    uint16_t delta;     //!< Ticks desde el registro anterior
+    uint8_t kind;       //!< Tipo de registro
+    uint8_t arg;        //!< Argumento del registro
+    uint32_t value;     //!< Valor del registro
+} record_entry_t;
+
+// Buffer completo tal como queda en memoria y en el archivo
+typedef struct record_buffer_s {
+    uint32_t magic;         //!< Siempre RECORD_MAGIC
+    uint16_t entries;       //!< Capacidad del buffer en registros
+    uint16_t entry_size;    //!< Tamaño en bytes de cada registro
+    uint16_t rate;          //!< Ticks por segundo de la aplicacion
+    uint16_t flags;         //!< Banderas RECORD_FLAG_*
+    uint32_t head;          //!< Cantidad de registros escritos
+    record_entry_t entry[RECORD_ENTRIES];
+} record_buffer_t;
+
+/* === Declaraciones de variables publicas ================================= */
+
+// Buffer de la grabacion, se puede volcar con gdb igual que el de la traza
+extern record_buffer_t RecordBuffer;
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Vacia el buffer y comienza una grabacion nueva
+ *
+ * @param rate  Ticks por segundo de la aplicacion
+ */
+void RecordStart(uint16_t rate);
+
+/**
+ * @brief Agrega un registro, todos los registros se deben agregar desde el mismo contexto
+ *
+ * @param tick  Tick de la aplicacion en el que ocurre el evento, no puede ser anterior al del registro previo
+ * @param kind  Tipo de registro
+ * @param arg   Argumento del registro
+ * @param value Valor del registro
+ */
+void RecordEvent(uint32_t tick, record_kind_t kind, uint8_t arg, uint32_t value);
+
+/**
+ * @brief Agrega una vuelta del lazo principal, desde el mismo contexto que el resto de los registros
+ *
+ * La vuelta se suma al ultimo tramo RECORD_LOOP si mantiene su periodo, si no abre un tramo nuevo.
+ * La reproduccion llama al lazo una vez despues del tick indicado.
+ *
+ * @param tick  Ultimo tick de la aplicacion antes de que la vuelta terminara
+ */
+void RecordLoop(uint32_t tick);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* RECORD_H */
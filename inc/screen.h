@@ -56,6 +56,7 @@
 /* === Inclusiones de archivos externos ==================================== */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /* === Cabecera C++ ======================================================== */
 #ifdef __cplusplus
@@ -74,6 +75,21 @@ extern "C" {
 #define SEGMENT_G (1 << 6)
 #define SEGMENT_P (1 << 7)
 
+// Cantidad de grupos de parpadeo independientes, el grupo cero es el que usa DisplayBlinkDigits
+#ifndef DISPLAY_BLINK_GROUPS
+    #define DISPLAY_BLINK_GROUPS 3
+#endif
+
+// Niveles de brillo, el nivel cero es el mas tenue sin apagar la pantalla
+#ifndef DISPLAY_BRIGHTNESS_LEVELS
+    #define DISPLAY_BRIGHTNESS_LEVELS 16
+#endif
+
+// Frecuencia minima en Hz con la que se enciende cada digito para que no se note el parpadeo
+#ifndef DISPLAY_DIGIT_RATE
+    #define DISPLAY_DIGIT_RATE 100
+#endif
+
 /* == Declaraciones de tipos de datos publicos ============================= */
 
 // Referencia a descriptor para gestionar una pantalla de siete segmentos multiplexada
@@ -85,10 +101,26 @@ typedef void(* display_number_on_t)(uint8_t number);
 
 typedef void(* display_digit_on_t)(uint8_t digit);
 
+typedef bool(* display_scan_t)(uint8_t digit, uint8_t segments);
+
+typedef void(* display_frame_write_t)(uint8_t const * segments, uint8_t digits);
+
+typedef void(* display_brightness_t)(uint8_t level);
+
+/* Si ScanDigit no es nulo cada refresco es una sola llamada y ScreenTurnOn y DigitTurnOn no se usan.
+   Si WriteFrame no es nulo el controlador multiplexa por su cuenta y solo recibe la pantalla completa
+   cuando cambia el cuadro o el parpadeo, y cada refresco llama a lo sumo a una de WriteFrame o
+   SetBrightness. Si SetBrightness es nulo el brillo se regula apagando el digito activo antes de
+   terminar su turno con DisplayDimTick. ScreenTurnOff tiene que apagar las salidas en el momento de
+   la llamada y ScanDigit volver a encenderlas, aunque el digito barrido se muestre un paso despues.
+   Si ScanDigit devuelve false no pudo enviar el digito y el proximo refresco lo vuelve a intentar */
 typedef struct display_driver_s {
     display_screen_off_t ScreenTurnOff;
     display_number_on_t ScreenTurnOn;
     display_digit_on_t DigitTurnOn;
+    display_scan_t ScanDigit;
+    display_frame_write_t WriteFrame;
+    display_brightness_t SetBrightness;
 } const * display_driver_t;
 
 /* === Declaraciones de variables publicas ================================= */
@@ -102,7 +134,9 @@ typedef struct display_driver_s {
 display_t DisplayCreate(uint8_t digits, display_driver_t driver);
 
 /**
- * @brief Funcion para escribir un numero BCD en la pantalla de siete segmentos
+ * @brief Funcion para escribir un numero BCD en la capa de digitos, no modifica los puntos
+ * 
+ * Las funciones de escritura componen sobre un cuadro oculto que se muestra recien al llamar a DisplayCommit
  * 
  * @param display   Puntero al descriptor de la pantalla en la que se escribe
  * @param number    Puntero al primer elemento de el numero BCD a escribir
@@ -110,6 +144,34 @@ display_t DisplayCreate(uint8_t digits, display_driver_t driver);
  */
 void DisplayWriteBCD( display_t display, uint8_t * number, uint8_t size);
 
+/**
+ * @brief Funcion para escribir un numero binario en la capa de digitos, completando con ceros a la izquierda
+ * 
+ * Convierte de a dos digitos con una tabla de pares, sin pasar por un vector de digitos BCD
+ * 
+ * @param display   Puntero al descriptor de la pantalla en la que se escribe
+ * @param value     Numero a mostrar, solo se muestran los digitos menos significativos que entran en la pantalla
+ */
+void DisplayWriteNumber(display_t display, uint32_t value);
+
+/**
+ * @brief Funcion para escribir una hora en formato HH:MM en los primeros cuatro digitos de la capa de digitos
+ * 
+ * @param display   Puntero al descriptor de la pantalla en la que se escribe
+ * @param hours     Valor binario que se muestra en los dos primeros digitos, entre 0 y 99
+ * @param minutes   Valor binario que se muestra en los dos digitos siguientes, entre 0 y 99
+ */
+void DisplayWriteTime(display_t display, uint8_t hours, uint8_t minutes);
+
+/**
+ * @brief Funcion para publicar el cuadro compuesto, intercambiando los cuadros visible y oculto
+ *
+ * Se debe llamar desde el mismo contexto que escribe en la pantalla, el refresco nunca ve un cuadro a medio escribir
+ * 
+ * @param display   Puntero al descriptor de la pantalla
+ */
+void DisplayCommit(display_t display);
+
 /**
  * @brief   Funcion para refrescar la pantalla
  * 
@@ -117,16 +179,65 @@ void DisplayWriteBCD( display_t display, uint8_t * number, uint8_t size);
  */
 void DisplayRefresh(display_t display);
 
+/**
+ * @brief Funcion para leer los segmentos del cuadro visible, con los puntos y sin aplicar el parpadeo
+ *
+ * @param display   Puntero al descriptor de la pantalla
+ * @param segments  Vector donde se copian los segmentos de cada digito
+ * @param size      Cantidad de elementos del vector
+ */
+void DisplayReadFrame(display_t display, uint8_t * segments, uint8_t size);
+
+/**
+ * @brief Funcion para consultar el numero del ultimo cuadro publicado, aumenta en uno con cada DisplayCommit que cambia la pantalla
+ *
+ * @param display   Puntero al descriptor de la pantalla
+ * @return uint32_t Numero de publicacion del cuadro visible
+ */
+uint32_t DisplayGetFrame(display_t display);
+
+/**
+ * @brief Funcion para consultar el numero del cuadro que uso el ultimo DisplayRefresh
+ *
+ * Permite saber cuando un cuadro publicado llego efectivamente a los terminales de la pantalla
+ *
+ * @param display   Puntero al descriptor de la pantalla
+ * @return uint32_t Numero de publicacion del cuadro refrescado
+ */
+uint32_t DisplayGetShownFrame(display_t display);
+
 /**
  * @brief Función para hacer parpadear digitos de la pantalla
  * 
  * @param display   Puntero al descriptor de la pantalla que se quiere utilizar
  * @param from      Posición del primer dígito que se quiere hacer parpadear
  * @param to        Posición del último dígito que se quiere hacer parpadear
- * @param frequency Factor de división de la frecuencia de refresco para el parpadeo
+ * @param frequency Periodo del parpadeo expresado en llamadas a DisplayBlinkTick
  */
 void DisplayBlinkDigits(display_t display, uint8_t from, uint8_t to, uint16_t frequency);
 
+/**
+ * @brief Función para hacer parpadear un grupo de segmentos con un periodo propio
+ * 
+ * El parpadeo se compone en el cuadro oculto igual que los digitos y empieza a regir, con la fase
+ * reiniciada, recien al llamar a DisplayCommit
+ * 
+ * @param display   Puntero al descriptor de la pantalla que se quiere utilizar
+ * @param group     Grupo de parpadeo, entre cero y DISPLAY_BLINK_GROUPS - 1
+ * @param from      Posición del primer dígito del grupo
+ * @param to        Posición del último dígito del grupo
+ * @param segments  Segmentos de cada dígito que parpadean, por ejemplo SEGMENT_P para los puntos
+ * @param period    Periodo del parpadeo en llamadas a DisplayBlinkTick, cero para detenerlo
+ */
+void DisplayBlinkSegments(display_t display, uint8_t group, uint8_t from, uint8_t to, uint8_t segments, uint16_t period);
+
+/**
+ * @brief Función para avanzar la base de tiempo del parpadeo, independiente del refresco
+ * 
+ * @param display   Puntero al descriptor de la pantalla que se quiere utilizar
+ */
+void DisplayBlinkTick(display_t display);
+
 /**
  * @brief Función para hacer parpadear los puntos de la pantalla
  * 
@@ -136,6 +247,56 @@ void DisplayBlinkDigits(display_t display, uint8_t from, uint8_t to, uint16_t fr
  */
 void DisplayToggleDots(display_t display, uint8_t from, uint8_t to);
 
+/**
+ * @brief Función para encender o apagar los puntos en la capa de indicadores
+ * 
+ * @param display   Puntero al descriptor de la pantalla que se quiere utilizar
+ * @param from      Posición del primer dígito cuyo punto se modifica
+ * @param to        Posición del último dígito cuyo punto se modifica
+ * @param state     Estado en el que quedan los puntos
+ */
+void DisplaySetDots(display_t display, uint8_t from, uint8_t to, bool state);
+
+/**
+ * @brief Función para fijar el brillo de la pantalla, se aplica en el proximo refresco
+ *
+ * @param display   Puntero al descriptor de la pantalla que se quiere utilizar
+ * @param level     Nivel de brillo, entre cero y DISPLAY_BRIGHTNESS_LEVELS - 1
+ */
+void DisplaySetBrightness(display_t display, uint8_t level);
+
+/**
+ * @brief Función para consultar el brillo de la pantalla
+ *
+ * @param display   Puntero al descriptor de la pantalla que se quiere utilizar
+ * @return uint8_t  Nivel de brillo fijado con DisplaySetBrightness
+ */
+uint8_t DisplayGetBrightness(display_t display);
+
+/**
+ * @brief Función para elegir la frecuencia de DisplayRefresh segun la cantidad de digitos
+ *
+ * Devuelve la menor frecuencia que divide a la del tick y enciende cada digito al menos
+ * DISPLAY_DIGIT_RATE veces por segundo, o la del tick si no alcanza. Los ticks que quedan en
+ * cada turno son los niveles de brillo distintos que puede dar DisplayDimTick
+ *
+ * @param display   Puntero al descriptor de la pantalla que se quiere utilizar
+ * @param tick_rate Frecuencia en Hz del tick desde el que se llama a DisplayRefresh
+ * @return uint16_t Frecuencia en Hz con la que se debe llamar a DisplayRefresh
+ */
+uint16_t DisplayScanRate(display_t display, uint16_t tick_rate);
+
+/**
+ * @brief Función para regular el brillo de una pantalla multiplexada sin control de brillo propio
+ *
+ * Se llama a una frecuencia varias veces mayor que la del refresco y despues de DisplayRefresh en
+ * el mismo tick. Apaga el digito activo cuando transcurre la fraccion de su turno que corresponde
+ * al brillo, la cantidad de niveles distintos es la cantidad de llamadas por turno
+ *
+ * @param display   Puntero al descriptor de la pantalla que se quiere utilizar
+ */
+void DisplayDimTick(display_t display);
+
 /* === Declaraciones de funciones publicas ================================= */
 
 /* === Ciere de documentacion ============================================== */
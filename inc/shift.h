@@ -0,0 +1,131 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file shift.h
+ **
+ ** @brief Pantallas en cadenas de registros de desplazamiento 74HC595
+ **
+ ** El primer registro de la cadena tiene los segmentos y los siguientes un bit por digito,
+ ** empezando por el digito cero. Cada barrido carga en las salidas la cadena enviada en el
+ ** paso anterior y empieza a enviar la nueva, y la habilitacion de las salidas apaga la
+ ** pantalla en el acto. La placa y el host comparten este archivo y cada uno entrega las
+ ** funciones que manejan el bus y los terminales.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup shift Cadena de registros
+ ** @brief Cadena de registros 74HC595
+ ** @{
+ */
+
+#ifndef SHIFT_H   /*! @cond    */
+#define SHIFT_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Cantidad maxima de digitos de la cadena, fija el tamaño de las copias de la cadena
+#ifndef SHIFT_MAX_DIGITS
+    #define SHIFT_MAX_DIGITS 32
+#endif
+
+// Bytes de una cadena con la cantidad de digitos indicada
+#define SHIFT_CHAIN_SIZE(digits) (1 + ((digits) + 7) / 8)
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Referencia a una cadena de registros
+typedef struct shift_s * shift_t;
+
+// Funciones de la placa que manejan la cadena
+typedef struct shift_driver_s {
+    void (*Send)(uint8_t const * chain, uint8_t size);  //!< Empieza a enviar la cadena, el ultimo byte queda en el primer registro
+    void (*Latch)(void);                                //!< Pasa a las salidas lo que termino de desplazarse
+    void (*Blank)(bool blank);                          //!< Apaga o vuelve a habilitar las salidas
+    bool (*Busy)(void);                                 //!< Indica si todavia se esta enviando la cadena anterior
+} const * shift_driver_t;
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Crea el descriptor de una cadena, apaga las salidas y envia una cadena vacia
+ *
+ * @param digits    Cantidad de digitos conectados, hasta SHIFT_MAX_DIGITS
+ * @param driver    Funciones de la placa que manejan la cadena
+ * @return shift_t  Puntero al descriptor de la cadena
+ */
+shift_t ShiftCreate(uint8_t digits, shift_driver_t driver);
+
+/**
+ * @brief Apaga las salidas en el acto, el proximo barrido las vuelve a encender
+ *
+ * @param shift     Puntero al descriptor de la cadena
+ */
+void ShiftBlank(shift_t shift);
+
+/**
+ * @brief Muestra la cadena enviada en el paso anterior y envia la de un digito
+ *
+ * Si la cadena anterior no termino de enviarse no se carga ni se envia nada, la pantalla
+ * mantiene el digito que muestra y quien barre debe volver a pedir el mismo digito
+ *
+ * @param shift     Puntero al descriptor de la cadena
+ * @param digit     Digito que se enciende
+ * @param segments  Segmentos del digito, con el punto en el bit 7
+ * @return true     Se envio la cadena del digito
+ * @return false    La cadena anterior todavia se estaba enviando
+ */
+bool ShiftScan(shift_t shift, uint8_t digit, uint8_t segments);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* SHIFT_H */
@@ -0,0 +1,193 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file stopwatch.h
+ **
+ ** @brief Cronometro y temporizador
+ **
+ ** Cronometros y temporizadores que no tienen logica por tick: guardan el valor de un
+ ** contador monotono compartido al arrancar y calculan el tiempo transcurrido o restante
+ ** solo cuando se los consulta. El contador lo incrementa la interrupcion a una frecuencia
+ ** fija que se informa al crear cada objeto.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup stopwatch Cronometro
+ ** @brief Cronometro y temporizador
+ ** @{
+ */
+
+#ifndef STOPWATCH_H   /*! @cond    */
+#define STOPWATCH_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Referencia a un descriptor de cronometro
+typedef struct stopwatch_s * stopwatch_t;
+
+// Referencia a un descriptor de temporizador
+typedef struct countdown_s * countdown_t;
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Crea un cronometro detenido y en cero
+ *
+ * @param counter       Contador monotono compartido, lo incrementa la interrupcion
+ * @param rate          Incrementos por segundo del contador
+ * @return stopwatch_t  Puntero al descriptor del cronometro
+ */
+stopwatch_t StopwatchCreate(volatile uint32_t const * counter, uint16_t rate);
+
+/**
+ * @brief Arranca el cronometro desde el valor acumulado, no hace nada si ya esta corriendo
+ *
+ * @param stopwatch     Puntero al descriptor del cronometro
+ */
+void StopwatchStart(stopwatch_t stopwatch);
+
+/**
+ * @brief Detiene el cronometro conservando el valor acumulado
+ *
+ * @param stopwatch     Puntero al descriptor del cronometro
+ */
+void StopwatchStop(stopwatch_t stopwatch);
+
+/**
+ * @brief Pone el cronometro en cero, sin cambiar si esta corriendo o detenido
+ *
+ * @param stopwatch     Puntero al descriptor del cronometro
+ */
+void StopwatchReset(stopwatch_t stopwatch);
+
+/**
+ * @brief Consulta si el cronometro esta corriendo
+ *
+ * @param stopwatch     Puntero al descriptor del cronometro
+ * @return true         El cronometro esta corriendo
+ * @return false        El cronometro esta detenido
+ */
+bool StopwatchIsRunning(stopwatch_t stopwatch);
+
+/**
+ * @brief Calcula el tiempo acumulado por el cronometro
+ *
+ * @param stopwatch     Puntero al descriptor del cronometro
+ * @return uint32_t     Tiempo acumulado en milisegundos
+ */
+uint32_t StopwatchGetElapsed(stopwatch_t stopwatch);
+
+/**
+ * @brief Crea un temporizador detenido y sin duracion
+ *
+ * @param counter       Contador monotono compartido, lo incrementa la interrupcion
+ * @param rate          Incrementos por segundo del contador
+ * @return countdown_t  Puntero al descriptor del temporizador
+ */
+countdown_t CountdownCreate(volatile uint32_t const * counter, uint16_t rate);
+
+/**
+ * @brief Fija el tiempo restante del temporizador y lo deja detenido
+ *
+ * @param countdown     Puntero al descriptor del temporizador
+ * @param duration      Tiempo restante en milisegundos
+ */
+void CountdownSetup(countdown_t countdown, uint32_t duration);
+
+/**
+ * @brief Arranca la cuenta regresiva desde el tiempo restante, no hace nada si no queda tiempo
+ *
+ * @param countdown     Puntero al descriptor del temporizador
+ */
+void CountdownStart(countdown_t countdown);
+
+/**
+ * @brief Detiene la cuenta regresiva conservando el tiempo restante
+ *
+ * @param countdown     Puntero al descriptor del temporizador
+ */
+void CountdownStop(countdown_t countdown);
+
+/**
+ * @brief Consulta si el temporizador esta contando
+ *
+ * @param countdown     Puntero al descriptor del temporizador
+ * @return true         La cuenta regresiva esta en curso
+ * @return false        El temporizador esta detenido o ya vencio
+ */
+bool CountdownIsRunning(countdown_t countdown);
+
+/**
+ * @brief Calcula el tiempo que le queda al temporizador
+ *
+ * @param countdown     Puntero al descriptor del temporizador
+ * @return uint32_t     Tiempo restante en milisegundos, cero si ya vencio
+ */
+uint32_t CountdownGetRemaining(countdown_t countdown);
+
+/**
+ * @brief Consulta si el temporizador llego a cero, se debe llamar periodicamente desde el lazo principal
+ *
+ * Al vencer el temporizador queda detenido y en cero
+ *
+ * @param countdown     Puntero al descriptor del temporizador
+ * @return true         La cuenta llego a cero desde la consulta anterior
+ * @return false        El temporizador sigue contando o ya se informo el vencimiento
+ */
+bool CountdownHasExpired(countdown_t countdown);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* STOPWATCH_H */
@@ -0,0 +1,140 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file ticker.h
+ **
+ ** @brief Despachador de eventos periodicos desde una unica interrupcion
+ **
+ ** Cada consumidor (barrido de la pantalla, reloj, parpadeo, etc.) se registra con
+ ** su propia frecuencia. Los divisores se calculan una sola vez al registrarse y la
+ ** interrupcion solo decrementa un contador por consumidor.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup ticker Despachador de ticks
+ ** @brief Despachador de eventos periodicos
+ ** @{
+ */
+
+#ifndef TICKER_H   /*! @cond    */
+#define TICKER_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Referencia a un despachador de eventos periodicos
+typedef struct ticker_s * ticker_t;
+
+// Funcion que se llama con la frecuencia solicitada por el consumidor
+typedef void (*ticker_handler_t)(void * object);
+
+// Funcion que recibe de una sola vez la cantidad de periodos que se perdieron
+typedef void (*ticker_catch_up_t)(void * object, uint32_t periods);
+
+/* === Declaraciones de variables publicas ================================= */
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Crea un despachador
+ *
+ * @param rate      Frecuencia en Hz de la interrupcion que llama a TickerDispatch
+ * @return ticker_t Puntero al descriptor del despachador creado
+ */
+ticker_t TickerCreate(uint16_t rate);
+
+/**
+ * @brief Registra un consumidor con su propia frecuencia
+ *
+ * @param ticker    Puntero al descriptor del despachador
+ * @param rate      Frecuencia en Hz, debe dividir exactamente a la frecuencia del despachador
+ * @param handler   Funcion que se llama en cada periodo del consumidor
+ * @param object    Argumento que se entrega a la funcion
+ * @return true     El consumidor se registro correctamente
+ * @return false    No hay lugar para mas consumidores o la frecuencia no es un divisor exacto
+ */
+bool TickerAttach(ticker_t ticker, uint16_t rate, ticker_handler_t handler, void * object);
+
+/**
+ * @brief Registra un consumidor que necesita recuperar los periodos perdidos, como el reloj
+ *
+ * @param ticker    Puntero al descriptor del despachador
+ * @param rate      Frecuencia en Hz, debe dividir exactamente a la frecuencia del despachador
+ * @param handler   Funcion que se llama en cada periodo del consumidor
+ * @param catch_up  Funcion que recibe los periodos perdidos cuando se llama a TickerSkip
+ * @param object    Argumento que se entrega a las funciones
+ * @return true     El consumidor se registro correctamente
+ * @return false    No hay lugar para mas consumidores o la frecuencia no es un divisor exacto
+ */
+bool TickerAttachCatchUp(ticker_t ticker, uint16_t rate, ticker_handler_t handler, ticker_catch_up_t catch_up, void * object);
+
+/**
+ * @brief Informa ticks de la interrupcion que se perdieron
+ *
+ * Los consumidores con recuperacion reciben sus periodos perdidos de una sola vez, al resto solo
+ * se les ajusta la fase para que sigan en sincronismo con la base de tiempo
+ *
+ * @param ticker    Puntero al descriptor del despachador
+ * @param ticks     Cantidad de ticks perdidos
+ */
+void TickerSkip(ticker_t ticker, uint32_t ticks);
+
+/**
+ * @brief Llama a los consumidores cuyo periodo se cumplio, se llama desde la interrupcion
+ *
+ * @param ticker    Puntero al descriptor del despachador
+ */
+void TickerDispatch(ticker_t ticker);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* TICKER_H */
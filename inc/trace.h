@@ -0,0 +1,162 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file trace.h
+ **
+ ** @brief Registro binario de eventos en memoria RAM
+ **
+ ** Buffer circular de registros compactos (marca de tiempo, evento y argumento)
+ ** para reconstruir lo que hicieron la interrupcion del SysTick y el lazo principal.
+ ** El buffer completo puede volcarse desde el depurador y decodificarse en el host
+ ** con la herramienta trace_decode.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup trace Registro de eventos
+ ** @brief Registro binario de eventos en RAM
+ ** @{
+ */
+
+#ifndef TRACE_H   /*! @cond    */
+#define TRACE_H   /*! @endcond */
+
+/* === Inclusiones de archivos externos ==================================== */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros publicos ======================================== */
+
+// Cantidad de registros del buffer circular, debe ser una potencia de dos
+#ifndef TRACE_RECORDS
+    #define TRACE_RECORDS 256
+#endif
+
+// Identificador del buffer para localizarlo dentro de un volcado de memoria ("TRC1")
+#define TRACE_MAGIC 0x31435254
+
+// Construye la mascara de filtro correspondiente a un evento
+#define TRACE_MASK(event) ((uint32_t)1 << (event))
+
+// Modos de la aplicacion en el orden que se registran como argumento de TRACE_EVENT_MODE, la
+// aplicacion arma con esta lista su enumeracion y la herramienta de decodificacion los nombres
+#define TRACE_MODES(MODE)               \
+    MODE(HORA_SIN_AJUSTAR)              \
+    MODE(MOSTRANDO_HORA)                \
+    MODE(AJUSTANDO_MINUTOS_ACTUAL)      \
+    MODE(AJUSTANDO_HORAS_ACTUAL)        \
+    MODE(AJUSTANDO_MINUTOS_ALARMA)      \
+    MODE(AJUSTANDO_HORAS_ALARMA)        \
+    MODE(CRONOMETRO)                    \
+    MODE(TEMPORIZADOR)
+
+/* == Declaraciones de tipos de datos publicos ============================= */
+
+// Eventos que se pueden registrar
+typedef enum {
+    TRACE_EVENT_TICK,           //!< Interrupcion del SysTick, argumento: ticks transcurridos
+    TRACE_EVENT_MODE,           //!< Cambio de modo, argumento: nuevo modo
+    TRACE_EVENT_ALARM,          //!< Disparo de la alarma, argumento: hora y minutos en BCD empaquetado
+    TRACE_EVENT_KEY,            //!< Flanco o repeticion de una tecla, argumento: tecla
+    TRACE_EVENT_COUNT,
+} trace_event_t;
+
+// Identificadores de las teclas usados como argumento de los eventos de teclado
+typedef enum {
+    TRACE_KEY_SET_TIME,
+    TRACE_KEY_SET_ALARM,
+    TRACE_KEY_DECREMENT,
+    TRACE_KEY_INCREMENT,
+    TRACE_KEY_ACCEPT,
+    TRACE_KEY_CANCEL,
+} trace_key_t;
+
+// Registro individual, ocupa ocho bytes
+typedef struct trace_record_s {
+    uint32_t timestamp;     //!< Valor del contador de ciclos al registrar el evento
+    uint16_t event;         //!< Evento registrado
+    uint16_t arg;           //!< Argumento asociado al evento
+} trace_record_t;
+
+// Buffer completo tal como queda en memoria y como lo lee la herramienta de decodificacion
+typedef struct trace_buffer_s {
+    uint32_t magic;         //!< Siempre TRACE_MAGIC
+    uint16_t records;       //!< Capacidad del buffer en registros
+    uint16_t record_size;   //!< Tamaño en bytes de cada registro
+    uint32_t frequency;     //!< Frecuencia del contador de ciclos en Hz
+    uint32_t head;          //!< Cantidad total de registros escritos desde el inicio
+    trace_record_t record[TRACE_RECORDS];
+} trace_buffer_t;
+
+/* === Declaraciones de variables publicas ================================= */
+
+// Buffer de eventos, se puede volcar con "dump binary value trace.bin TraceBuffer" desde gdb
+extern trace_buffer_t TraceBuffer;
+
+/* === Declaraciones de funciones publicas ================================= */
+
+/**
+ * @brief Inicializa el contador de ciclos usado como base de tiempo del registro
+ */
+void TraceInit(void);
+
+/**
+ * @brief Selecciona los eventos que se registran
+ *
+ * @param mask  Mascara construida con TRACE_MASK, por defecto se excluye TRACE_EVENT_TICK
+ */
+void TraceSetFilter(uint32_t mask);
+
+/**
+ * @brief Agrega un evento al buffer circular, se puede llamar desde interrupciones
+ *
+ * @param event Evento a registrar
+ * @param arg   Argumento asociado al evento
+ */
+void TraceRecord(trace_event_t event, uint16_t arg);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* TRACE_H */
@@ -0,0 +1,170 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file ambient.c
+ **
+ ** @brief Brillo automatico segun la luz ambiente
+ **
+ ** Promedio del buffer de conversiones, filtro entre promedios y niveles con histeresis
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup ambient Luz ambiente
+ ** @brief Brillo automatico segun la luz ambiente
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "ambient.h"
+
+/* === Definicion y Macros privados ======================================== */
+
+// Conversiones del buffer circular que se promedian en cada actualizacion
+#ifndef AMBIENT_SAMPLES
+    #define AMBIENT_SAMPLES 64
+#endif
+
+// Peso de cada promedio nuevo en el filtro, uno en dos a la AMBIENT_FILTER
+#ifndef AMBIENT_FILTER
+    #define AMBIENT_FILTER 3
+#endif
+
+// La luz debe salir del nivel actual mas de una fraccion 1 / AMBIENT_HYSTERESIS de su ancho para cambiarlo
+#ifndef AMBIENT_HYSTERESIS
+    #define AMBIENT_HYSTERESIS 4
+#endif
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+struct ambient_s {
+    light_driver_t driver;
+    uint8_t levels;
+    uint8_t level;                      //!< Nivel actual, solo cambia al superar la histeresis
+    uint16_t band;                      //!< Ancho de cada nivel en unidades del conversor
+    bool ready;                         //!< Ya se promedio al menos una conversion
+    uint32_t filtered;                  //!< Luz filtrada multiplicada por dos a la AMBIENT_FILTER
+    uint32_t buffer[AMBIENT_SAMPLES];   //!< Conversiones que escribe el DMA
+};
+
+/* === Definiciones de variables privadas ================================== */
+
+static struct ambient_s instances[1];
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static bool Average(ambient_t ambient, uint16_t * average);
+
+/* === Definiciones de funciones privadas ================================== */
+
+// Promedia las posiciones del buffer que ya tienen una conversion, el DMA sigue escribiendo mientras tanto
+static bool Average(ambient_t ambient, uint16_t * average){
+    uint32_t sum = 0;
+    uint16_t count = 0;
+
+    for (uint16_t index = 0; index < AMBIENT_SAMPLES; index++){
+        uint16_t value = ambient->driver->Value(ambient->buffer[index]);
+
+        if (value != AMBIENT_NO_SAMPLE){
+            sum += value;
+            count++;
+        }
+    }
+    if (count) *average = sum / count;
+    return count != 0;
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+ambient_t AmbientCreate(light_driver_t driver, uint8_t levels){
+    ambient_t ambient = instances;
+
+    ambient->driver = driver;
+    ambient->levels = levels ? levels : 1;
+    ambient->level = 0;
+    ambient->band = ((uint32_t) driver->full_scale + 1) / ambient->levels;
+    if (ambient->band == 0) ambient->band = 1;
+    ambient->ready = false;
+    ambient->filtered = 0;
+    for (uint16_t index = 0; index < AMBIENT_SAMPLES; index++){
+        ambient->buffer[index] = 0;
+    }
+    driver->Start(ambient->buffer, AMBIENT_SAMPLES);
+    return ambient;
+}
+
+bool AmbientUpdate(ambient_t ambient){
+    uint16_t average, light, lower, margin;
+    uint8_t level;
+
+    if (!Average(ambient, &average)) return false;
+
+    if (ambient->ready){
+        ambient->filtered += average - (ambient->filtered >> AMBIENT_FILTER);
+    } else {
+        ambient->filtered = (uint32_t) average << AMBIENT_FILTER;
+    }
+    light = ambient->filtered >> AMBIENT_FILTER;
+
+    /* El primer promedio fija el nivel sin histeresis, despues hay que pasar el limite por un margen */
+    lower = ambient->level * ambient->band;
+    margin = ambient->band / AMBIENT_HYSTERESIS;
+    if (ambient->ready && (light + margin >= lower) && (light < lower + ambient->band + margin)){
+        return false;
+    }
+
+    level = light / ambient->band;
+    if (level >= ambient->levels) level = ambient->levels - 1;
+    if (ambient->ready && (level == ambient->level)) return false;
+
+    ambient->ready = true;
+    ambient->level = level;
+    return true;
+}
+
+uint8_t AmbientGetLevel(ambient_t ambient){
+    return ambient->level;
+}
+
+uint16_t AmbientGetLight(ambient_t ambient){
+    return ambient->filtered >> AMBIENT_FILTER;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
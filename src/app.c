@@ -0,0 +1,1050 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file app.c
+ **
+ ** @brief Logica del reloj despertador
+ **
+ ** Maquina de estados del reloj despertador, separada de main.c para que el mismo
+ ** codigo se ejecute en la placa y en el simulador del host.
+ **
+ ** @addtogroup app Aplicacion
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "app.h"
+#include "screen.h"
+#include "clock.h"
+#include "trace.h"
+#include "ticker.h"
+#include "buzzer.h"
+#include "bcd.h"
+#include "console.h"
+#include "discipline.h"
+#include "latency.h"
+#include "record.h"
+#include "stopwatch.h"
+#include "ambient.h"
+
+/* === Macros definitions ====================================================================== */
+
+// Frecuencias en Hz de cada consumidor del despachador, deben dividir a APP_TICKS_PER_SECOND
+#define FRECUENCIA_RELOJ 1000
+
+#define FRECUENCIA_MILISEGUNDOS 1000
+
+#define FRECUENCIA_PARPADEO 100
+
+#define FRECUENCIA_ZUMBADOR BUZZER_TICK_RATE
+
+// Las teclas se muestrean en la interrupcion solo para medir la demora hasta la pantalla
+#define FRECUENCIA_TECLAS 1000
+
+// Con DIGITAL_DEBOUNCE_SAMPLES muestras un cambio de tecla se acepta cuando se mantiene 20 ms,
+// debe dividir a FRECUENCIA_TECLAS para que cada muestra del filtro coincida con una de la grabacion
+#define FRECUENCIA_ANTIRREBOTE 200
+
+// El pulso de referencia se muestrea con la misma resolucion que tiene el reloj
+#define FRECUENCIA_PULSO FRECUENCIA_RELOJ
+
+// El brillo se regula apagando el digito dentro de su turno, con la resolucion del tick
+#define FRECUENCIA_ATENUACION APP_TICKS_PER_SECOND
+
+// Periodo del parpadeo en ticks de parpadeo, equivale a un segundo
+#define PERIODO_PARPADEO FRECUENCIA_PARPADEO
+
+// Periodo del parpadeo del indicador de alarma mientras suena
+#define PERIODO_ALARMA (FRECUENCIA_PARPADEO / 4)
+
+// Grupos de parpadeo de la pantalla
+#define PARPADEO_DIGITOS 0
+
+#define PARPADEO_SEPARADOR 1
+
+#define PARPADEO_ALARMA 2
+
+// Largo maximo de una linea del volcado de la traza por la consola
+#define LINEA_TRAZA 24
+
+// Largo maximo de una linea del informe de latencia, con todos los campos en su valor maximo
+#define LINEA_LATENCIA 112
+
+#define HISTOGRAMAS_LATENCIA (LATENCY_KEYS * LATENCY_MODES)
+
+// Desplazamiento de cada campo editable dentro de la hora empaquetada como 0xHHMM
+#define CAMPO_MINUTOS 0
+
+#define CAMPO_HORAS 8
+
+// Paso de ajuste y duracion maxima del temporizador, en milisegundos
+#define PASO_TEMPORIZADOR 60000
+
+#define LIMITE_TEMPORIZADOR (99 * PASO_TEMPORIZADOR)
+
+// Brillo de la pantalla en la oscuridad, cada nivel de luz ambiente lo sube un paso hasta el maximo
+#define BRILLO_MINIMO 4
+
+// Arma la enumeracion de los modos a partir de la lista compartida con la decodificacion de la traza
+#define MODO(nombre) nombre,
+
+/* === Private data type declarations ========================================================== */
+
+// Zona horaria que se muestra por la consola, con su diferencia en minutos respecto de la hora local
+typedef struct zona_s {
+    const char * nombre;
+    int16_t minutos;
+} const * zona_t;
+
+typedef enum {
+    TRACE_MODES(MODO)
+} modo_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+static void ChangeMode(modo_t valor);
+
+static void AlarmaActivada(clock_t clock, bool state);
+
+static void AjustarEntrada(uint8_t campo, bcd_t limite, bool incrementar);
+
+static void ContarMilisegundos(void * object);
+
+static void AvanzarReloj(void * object);
+
+static void RecuperarReloj(void * object, uint32_t periodos);
+
+static void RecuperarMilisegundos(void * object, uint32_t periodos);
+
+static void RefrescarPantalla(void * object);
+
+static void AvanzarParpadeo(void * object);
+
+static void AtenuarPantalla(void * object);
+
+static void AvanzarZumbador(void * object);
+
+static void MuestrearPulso(void * object);
+
+static void MuestrearTeclas(void * object);
+
+static void FiltrarTeclas(void * object);
+
+static void AtenderTecla(trace_key_t tecla);
+
+static void GrabarCuadro(display_t display);
+
+static void GrabarLazo(void);
+
+static void MostrarHora(void);
+
+static void MostrarPuntos(void);
+
+static void MostrarCronometro(void);
+
+static void MostrarDuracion(uint32_t milisegundos);
+
+static void AjustarTemporizador(bool incrementar);
+
+static void VolverAHora(void);
+
+static void ComandoHora(console_t consola, uint8_t cantidad, uint32_t const * valores);
+
+static void ComandoFecha(console_t consola, uint8_t cantidad, uint32_t const * valores);
+
+static void ComandoAlarma(console_t consola, uint8_t cantidad, uint32_t const * valores);
+
+static void ComandoApagar(console_t consola, uint8_t cantidad, uint32_t const * valores);
+
+static void ComandoEstado(console_t consola, uint8_t cantidad, uint32_t const * valores);
+
+static void ComandoTraza(console_t consola, uint8_t cantidad, uint32_t const * valores);
+
+static void ComandoSincronizar(console_t consola, uint8_t cantidad, uint32_t const * valores);
+
+static void ComandoLatencia(console_t consola, uint8_t cantidad, uint32_t const * valores);
+
+static void ComandoZonas(console_t consola, uint8_t cantidad, uint32_t const * valores);
+
+static void ComandoLuz(console_t consola, uint8_t cantidad, uint32_t const * valores);
+
+static bcd_t Empaquetar(uint32_t valor);
+
+static void ImprimirHora(console_t consola, uint8_t const * hora, uint8_t campos);
+
+static bool LeerDias(uint32_t digitos, uint8_t * dias);
+
+static void ImprimirDias(console_t consola, uint8_t dias);
+
+static void VolcarTraza(void);
+
+static void VolcarLatencia(void);
+
+/* === Public variable definitions ============================================================= */
+
+static board_t board;
+
+static modo_t modo;
+
+static clock_t reloj;
+
+static ticker_t ticker;
+
+static volatile uint32_t milisegundos = 0;
+
+static const bcd_t LIMITE_MINUTOS = 0x60;
+
+static const bcd_t LIMITE_HORAS = 0x24;
+
+static uint8_t entrada[4];
+
+static uint8_t mostrada[4];
+
+static console_t consola;
+
+static discipline_t disciplina;
+
+// Estado del reloj capturado en el flanco del ultimo pulso de referencia, se procesa en el lazo principal
+static struct discipline_sample_s pulso;
+
+static volatile bool hay_pulso = false;
+
+// La alarma se dispara en la interrupcion y el indicador se compone en el lazo principal
+static volatile bool alarma_disparada = false;
+
+static latency_t latencia;
+
+// Teclas de la placa en el orden de trace_key_t
+static digital_input_t teclas[LATENCY_KEYS];
+
+// Ticks de la aplicacion desde el inicio, incluidos los recuperados, es la base de tiempo de la grabacion
+static uint32_t tick_actual = 0;
+
+// Estado de las teclas en el ultimo muestreo, un bit por tecla, para grabar solo los flancos
+static uint8_t teclas_presionadas = 0;
+
+// Numero del ultimo cuadro grabado
+static uint32_t cuadro_grabado;
+
+// Vueltas completas del lazo principal, la interrupcion graba las que todavia no vio
+static volatile uint32_t vueltas_lazo = 0;
+
+static uint32_t vueltas_grabadas = 0;
+
+// Proximo registro de la traza que se debe enviar por la consola y registro en el que termina el volcado
+static uint32_t volcado;
+
+static uint32_t fin_volcado;
+
+// Proximo histograma del informe de latencia y pedido de borrarlos cuando se termina de enviar
+static uint8_t informe_latencia;
+
+static bool borrar_latencia;
+
+static stopwatch_t cronometro;
+
+static countdown_t temporizador;
+
+// Indica que el zumbador suena por el vencimiento del temporizador y no por la alarma
+static bool aviso_temporizador = false;
+
+// Duracion en centesimas que muestra la pantalla en los modos de cronometro y temporizador
+static uint32_t duracion_mostrada;
+
+static ambient_t ambiente;
+
+static const struct console_command_s COMANDOS[] = {
+    {"hora", "[HH:MM[:SS]] consulta o ajusta la hora", ComandoHora},
+    {"fecha", "[AAAA-MM-DD] consulta o ajusta la fecha", ComandoFecha},
+    {"alarma", "[HH:MM [dias]] ajusta, dias 1=lun..7=dom", ComandoAlarma},
+    {"apagar", "silencia y desactiva la alarma", ComandoApagar},
+    {"estado", "estadisticas del SysTick", ComandoEstado},
+    {"traza", "vuelca los eventos registrados", ComandoTraza},
+    {"sincronizar", "HH:MM:SS corrige la hora sin saltos contra una referencia", ComandoSincronizar},
+    {"latencia", "[0] demoras de tecla a pantalla por tecla y modo, con 0 las borra despues de enviarlas", ComandoLatencia},
+    {"zonas", "hora y fecha en otras zonas horarias", ComandoZonas},
+    {"luz", "luz ambiente y brillo de la pantalla", ComandoLuz},
+};
+
+// Zonas respecto de la hora local de Argentina, sin horario de verano
+static const struct zona_s ZONAS[] = {
+    {"UTC", 180},
+    {"Madrid", 240},
+    {"Nueva York", -120},
+    {"Tokio", 720},
+};
+
+// Las vistas solo guardan la diferencia, todas se calculan desde el mismo reloj
+static clock_view_t zonas[sizeof(ZONAS) / sizeof(ZONAS[0])];
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void ChangeMode(modo_t valor) {
+    modo = valor;
+    TraceRecord(TRACE_EVENT_MODE, valor);
+
+    switch (modo){
+    case HORA_SIN_AJUSTAR:
+        DisplayBlinkDigits(board->display, 0, 3, PERIODO_PARPADEO);
+        break;
+    case MOSTRANDO_HORA:
+        DisplayBlinkDigits(board->display, 0, 0, 0);
+        break;
+    case AJUSTANDO_MINUTOS_ACTUAL:
+        DisplayBlinkDigits(board->display, 2, 3, PERIODO_PARPADEO);
+        break;
+    case AJUSTANDO_HORAS_ACTUAL:
+        DisplayBlinkDigits(board->display, 0, 1, PERIODO_PARPADEO);
+        break;
+    case AJUSTANDO_MINUTOS_ALARMA:
+        DisplayBlinkDigits(board->display, 2, 3, PERIODO_PARPADEO);
+        break;
+    case AJUSTANDO_HORAS_ALARMA:
+        DisplayBlinkDigits(board->display, 0, 1, PERIODO_PARPADEO);
+        break;
+    case CRONOMETRO:
+    case TEMPORIZADOR:
+        DisplayBlinkDigits(board->display, 0, 0, 0);
+        break;
+    
+    default:
+        break;
+    }
+
+    /* El separador de horas y minutos solo parpadea mientras se muestra la hora */
+    if(modo <= MOSTRANDO_HORA){
+        DisplayBlinkSegments(board->display, PARPADEO_SEPARADOR, 1, 1, SEGMENT_P, PERIODO_PARPADEO);
+    }else{
+        DisplayBlinkSegments(board->display, PARPADEO_SEPARADOR, 1, 1, SEGMENT_P, 0);
+    }
+
+    /* Se fuerza a que la hora se vuelva a escribir al regresar a los modos que la muestran */
+    memset(mostrada, 0xFF, sizeof(mostrada));
+    duracion_mostrada = UINT32_MAX;
+    MostrarPuntos();
+}
+
+/* Los puntos son una capa aparte, solo se actualizan cuando cambia el modo o el estado de la alarma */
+static void MostrarPuntos(void) {
+    uint8_t alarma[4];
+
+    if(modo <= MOSTRANDO_HORA){
+        DisplaySetDots(board->display, 0, 3, false);
+        DisplaySetDots(board->display, 1, 1, true);
+        DisplaySetDots(board->display, 3, 3, ClockGetAlarm(reloj, alarma, sizeof(alarma)));
+    }else if((modo == AJUSTANDO_MINUTOS_ALARMA) || (modo == AJUSTANDO_HORAS_ALARMA)){
+        DisplaySetDots(board->display, 0, 3, true);
+    }else if((modo == CRONOMETRO) || (modo == TEMPORIZADOR)){
+        DisplaySetDots(board->display, 0, 3, false);
+        DisplaySetDots(board->display, 1, 1, true);
+    }else{
+        DisplaySetDots(board->display, 0, 3, false);
+    }
+}
+
+static void AlarmaActivada(clock_t clock, bool state){
+    (void) clock;
+
+    if (state){
+        BuzzerStart(board->buzzer);
+        alarma_disparada = true;
+    }
+}
+
+/* Incrementa o decrementa un campo de la entrada con vuelta en el limite, los demas digitos no cambian */
+static void AjustarEntrada(uint8_t campo, bcd_t limite, bool incrementar){
+    bcd_t valor = BcdPack(entrada, sizeof(entrada));
+    bcd_t actual = (valor >> campo) & 0xFF;
+
+    actual = incrementar ? BcdAddMod(actual, 1, limite) : BcdSubMod(actual, 1, limite);
+    valor = (valor & ~((bcd_t) 0xFF << campo)) | (actual << campo);
+    BcdUnpack(valor, entrada, sizeof(entrada));
+}
+
+// Convierte un valor binario entre 0 y 99 en dos digitos BCD empaquetados
+static bcd_t Empaquetar(uint32_t valor){
+    return ((valor / 10) << 4) | (valor % 10);
+}
+
+static void ImprimirHora(console_t consola, uint8_t const * hora, uint8_t campos){
+    for (uint8_t campo = 0; campo < campos; campo++){
+        if (campo) ConsolePrint(consola, ":");
+        ConsolePrintNumber(consola, 10 * hora[2 * campo] + hora[2 * campo + 1], 2);
+    }
+}
+
+// Convierte los digitos del 1 (lunes) al 7 (domingo) en una mascara de dias, sin el cero para no perderlo adelante
+static bool LeerDias(uint32_t digitos, uint8_t * dias){
+    *dias = 0;
+    do {
+        uint8_t dia = digitos % 10;
+
+        if ((dia < 1) || (dia > 7)) return false;
+        *dias |= DATE_WEEKDAY_MASK(dia % 7);
+        digitos = digitos / 10;
+    } while (digitos);
+    return true;
+}
+
+static void ImprimirDias(console_t consola, uint8_t dias){
+    if (dias == 0){
+        ConsolePrint(consola, "ninguno");
+    }
+    for (uint8_t dia = 1; dia <= 7; dia++){
+        if (dias & DATE_WEEKDAY_MASK(dia % 7)) ConsolePrintNumber(consola, dia, 1);
+    }
+}
+
+static void ComandoHora(console_t consola, uint8_t cantidad, uint32_t const * valores){
+    uint8_t hora[6];
+
+    if (cantidad >= 2){
+        uint32_t segundos = (cantidad > 2) ? valores[2] : 0;
+
+        if ((valores[0] > 23) || (valores[1] > 59) || (segundos > 59)){
+            ConsolePrint(consola, "hora invalida\r\n");
+            return;
+        }
+        BcdUnpack((Empaquetar(valores[0]) << 16) | (Empaquetar(valores[1]) << 8) | Empaquetar(segundos), hora, sizeof(hora));
+        ClockSetupTime(reloj, hora, sizeof(hora));
+        if (modo == HORA_SIN_AJUSTAR){
+            ChangeMode(MOSTRANDO_HORA);
+        }
+    }
+    if (!ClockGetTime(reloj, hora, sizeof(hora))){
+        ConsolePrint(consola, "sin ajustar ");
+    }
+    ImprimirHora(consola, hora, 3);
+    ConsolePrint(consola, "\r\n");
+}
+
+static void ComandoFecha(console_t consola, uint8_t cantidad, uint32_t const * valores){
+    struct date_s fecha;
+
+    if (cantidad >= 3){
+        if ((valores[0] < 1970) || (valores[0] > UINT16_MAX) || (valores[1] < 1) || (valores[1] > 12) ||
+            (valores[2] < 1) || (valores[2] > DateDaysInMonth(valores[0], valores[1]))){
+            ConsolePrint(consola, "fecha invalida\r\n");
+            return;
+        }
+        fecha.year = valores[0];
+        fecha.month = valores[1];
+        fecha.day = valores[2];
+        ClockSetupDate(reloj, DateToDays(&fecha));
+    }
+    DateFromDays(ClockGetDate(reloj), &fecha);
+    ConsolePrintNumber(consola, fecha.year, 4);
+    ConsolePrint(consola, "-");
+    ConsolePrintNumber(consola, fecha.month, 2);
+    ConsolePrint(consola, "-");
+    ConsolePrintNumber(consola, fecha.day, 2);
+    ConsolePrint(consola, "\r\n");
+}
+
+static void ComandoAlarma(console_t consola, uint8_t cantidad, uint32_t const * valores){
+    uint8_t alarma[4];
+    uint8_t dias;
+    bool activada;
+
+    if (cantidad >= 2){
+        if ((valores[0] > 23) || (valores[1] > 59)){
+            ConsolePrint(consola, "hora invalida\r\n");
+            return;
+        }
+        if ((cantidad > 2) && !LeerDias(valores[2], &dias)){
+            ConsolePrint(consola, "dias invalidos, del 1 (lunes) al 7 (domingo)\r\n");
+            return;
+        }
+        BcdUnpack((Empaquetar(valores[0]) << 8) | Empaquetar(valores[1]), alarma, sizeof(alarma));
+        ClockSetupAlarm(reloj, alarma, sizeof(alarma));
+        /* Sin dias la alarma conserva los que tenia */
+        if (cantidad > 2) ClockSetupAlarmDays(reloj, dias);
+        MostrarPuntos();
+    }
+    activada = ClockGetAlarm(reloj, alarma, sizeof(alarma));
+    ImprimirHora(consola, alarma, 2);
+    ConsolePrint(consola, activada ? " activada, dias " : " desactivada, dias ");
+    ImprimirDias(consola, ClockGetAlarmDays(reloj));
+    ConsolePrint(consola, ", hoy ");
+    ImprimirDias(consola, DATE_WEEKDAY_MASK(ClockGetWeekday(reloj)));
+    ConsolePrint(consola, "\r\n");
+}
+
+static void ComandoApagar(console_t consola, uint8_t cantidad, uint32_t const * valores){
+    uint8_t alarma[4];
+
+    (void) cantidad;
+    (void) valores;
+
+    BuzzerStop(board->buzzer);
+    aviso_temporizador = false;
+    DisplayBlinkSegments(board->display, PARPADEO_ALARMA, 3, 3, SEGMENT_P, 0);
+    if (ClockGetAlarm(reloj, alarma, sizeof(alarma))){
+        ClockToggleAlarm(reloj);
+        MostrarPuntos();
+    }
+    ConsolePrint(consola, "alarma desactivada\r\n");
+}
+
+static void ComandoEstado(console_t consola, uint8_t cantidad, uint32_t const * valores){
+    struct sistick_stats_s estadisticas;
+    struct discipline_status_s disciplinado;
+    uint32_t desfase;
+
+    (void) cantidad;
+    (void) valores;
+
+    SisTick_GetStats(&estadisticas);
+    ConsolePrint(consola, "ticks perdidos ");
+    ConsolePrintNumber(consola, estadisticas.lost, 1);
+    ConsolePrint(consola, ", desbordes ");
+    ConsolePrintNumber(consola, estadisticas.overruns, 1);
+    ConsolePrint(consola, ", retraso maximo ");
+    ConsolePrintNumber(consola, estadisticas.max_lateness, 1);
+    ConsolePrint(consola, " ciclos\r\n");
+
+    DisciplineGetStatus(disciplina, &disciplinado);
+    ConsolePrint(consola, "referencias ");
+    ConsolePrintNumber(consola, disciplinado.updates, 1);
+    ConsolePrint(consola, ", desfase ");
+    if (disciplinado.offset < 0) ConsolePrint(consola, "-");
+    /* El desfase esta en ticks del reloj, un salto de medio dia no entra en 32 bits al pasarlo a milisegundos */
+    desfase = (disciplinado.offset < 0) ? -(uint32_t) disciplinado.offset : (uint32_t) disciplinado.offset;
+    ConsolePrintNumber(consola, (uint64_t) desfase * 1000 / FRECUENCIA_RELOJ, 1);
+    ConsolePrint(consola, " ms, frecuencia ");
+    if (disciplinado.frequency < 0) ConsolePrint(consola, "-");
+    ConsolePrintNumber(consola, (disciplinado.frequency < 0) ? -disciplinado.frequency : disciplinado.frequency, 1);
+    ConsolePrint(consola, " ppm, saltos ");
+    ConsolePrintNumber(consola, disciplinado.steps, 1);
+    ConsolePrint(consola, "\r\n");
+}
+
+static void ComandoTraza(console_t consola, uint8_t cantidad, uint32_t const * valores){
+    uint32_t escritos = TraceBuffer.head;
+
+    (void) consola;
+    (void) cantidad;
+    (void) valores;
+
+    /* El volcado se envia de a una linea en cada pasada del lazo principal, a medida que hay lugar */
+    volcado = (escritos > TRACE_RECORDS) ? escritos - TRACE_RECORDS : 0;
+    fin_volcado = escritos;
+}
+
+static void ComandoSincronizar(console_t consola, uint8_t cantidad, uint32_t const * valores){
+    struct discipline_sample_s muestra;
+    uint8_t hora[6];
+
+    /* El estado del reloj se toma antes de validar para que la muestra quede lo mas cerca de la referencia */
+    DisciplineCapture(disciplina, &muestra);
+    if ((cantidad < 3) || (valores[0] > 23) || (valores[1] > 59) || (valores[2] > 59)){
+        ConsolePrint(consola, "hora invalida\r\n");
+        return;
+    }
+    DisciplineReference(disciplina, (valores[0] * 60 + valores[1]) * 60 + valores[2], &muestra);
+    if (modo == HORA_SIN_AJUSTAR){
+        ChangeMode(MOSTRANDO_HORA);
+    }
+    ClockGetTime(reloj, hora, sizeof(hora));
+    ImprimirHora(consola, hora, 3);
+    ConsolePrint(consola, "\r\n");
+}
+
+// Imprime una linea por cada tecla y modo con mediciones, con los intervalos del histograma en milisegundos
+static void ComandoLatencia(console_t consola, uint8_t cantidad, uint32_t const * valores){
+    (void) consola;
+
+    /* El informe se envia de a una linea en cada pasada del lazo principal, a medida que hay lugar, y
+       los histogramas se borran recien despues de enviar el ultimo */
+    informe_latencia = 0;
+    borrar_latencia = (cantidad > 0) && (valores[0] == 0);
+}
+
+static void ComandoZonas(console_t consola, uint8_t cantidad, uint32_t const * valores){
+    uint8_t hora[6];
+    struct date_s fecha;
+
+    (void) cantidad;
+    (void) valores;
+
+    for (uint8_t zona = 0; zona < sizeof(ZONAS) / sizeof(ZONAS[0]); zona++){
+        ConsolePrint(consola, ZONAS[zona].nombre);
+        ConsolePrint(consola, ClockViewGetTime(zonas[zona], hora, sizeof(hora)) ? " " : " sin ajustar ");
+        ImprimirHora(consola, hora, 3);
+        DateFromDays(ClockViewGetDate(zonas[zona]), &fecha);
+        ConsolePrint(consola, " ");
+        ConsolePrintNumber(consola, fecha.year, 4);
+        ConsolePrint(consola, "-");
+        ConsolePrintNumber(consola, fecha.month, 2);
+        ConsolePrint(consola, "-");
+        ConsolePrintNumber(consola, fecha.day, 2);
+        ConsolePrint(consola, "\r\n");
+    }
+}
+
+static void ComandoLuz(console_t consola, uint8_t cantidad, uint32_t const * valores){
+    (void) cantidad;
+    (void) valores;
+
+    ConsolePrint(consola, "luz ");
+    ConsolePrintNumber(consola, AmbientGetLight(ambiente), 4);
+    ConsolePrint(consola, " nivel ");
+    ConsolePrintNumber(consola, AmbientGetLevel(ambiente), 2);
+    ConsolePrint(consola, " brillo ");
+    ConsolePrintNumber(consola, DisplayGetBrightness(board->display), 2);
+    ConsolePrint(consola, "\r\n");
+}
+
+// Envia los registros pendientes de la traza como "ciclos evento argumento" mientras haya lugar para transmitir
+static void VolcarTraza(void){
+    while ((volcado != fin_volcado) && (ConsoleFree(consola) >= LINEA_TRAZA)){
+        trace_record_t const * registro = &TraceBuffer.record[volcado % TRACE_RECORDS];
+
+        ConsolePrintNumber(consola, registro->timestamp, 10);
+        ConsolePrint(consola, " ");
+        ConsolePrintNumber(consola, registro->event, 1);
+        ConsolePrint(consola, " ");
+        ConsolePrintNumber(consola, registro->arg, 5);
+        ConsolePrint(consola, "\r\n");
+        volcado++;
+    }
+}
+
+// Envia los histogramas de latencia pendientes como "tecla modo: cantidad prom max | intervalos"
+static void VolcarLatencia(void){
+    while ((informe_latencia < HISTOGRAMAS_LATENCIA) && (ConsoleFree(consola) >= LINEA_LATENCIA)){
+        uint8_t tecla = informe_latencia / LATENCY_MODES;
+        uint8_t estado = informe_latencia % LATENCY_MODES;
+        latency_histogram_t histograma = LatencyGetHistogram(latencia, tecla, estado);
+
+        informe_latencia++;
+        if (histograma->count == 0) continue;
+        ConsolePrint(consola, "tecla ");
+        ConsolePrintNumber(consola, tecla, 1);
+        ConsolePrint(consola, " modo ");
+        ConsolePrintNumber(consola, estado, 1);
+        ConsolePrint(consola, ": ");
+        ConsolePrintNumber(consola, histograma->count, 1);
+        ConsolePrint(consola, " prom ");
+        ConsolePrintNumber(consola, histograma->total / histograma->count, 1);
+        ConsolePrint(consola, " max ");
+        ConsolePrintNumber(consola, histograma->max, 1);
+        ConsolePrint(consola, " us |");
+        for (uint8_t intervalo = 0; intervalo < LATENCY_BUCKETS; intervalo++){
+            ConsolePrint(consola, " ");
+            ConsolePrintNumber(consola, histograma->bucket[intervalo], 1);
+        }
+        ConsolePrint(consola, "\r\n");
+    }
+    if ((informe_latencia == HISTOGRAMAS_LATENCIA) && borrar_latencia){
+        LatencyClear(latencia);
+        borrar_latencia = false;
+    }
+}
+
+static void ContarMilisegundos(void * object) {
+    (void) object;
+    milisegundos++;
+}
+
+static void AvanzarReloj(void * object) {
+    ClockNewTick(object);
+}
+
+static void RecuperarReloj(void * object, uint32_t periodos) {
+    ClockAdvance(object, periodos);
+}
+
+static void RecuperarMilisegundos(void * object, uint32_t periodos) {
+    (void) object;
+    milisegundos += periodos;
+}
+
+static void RefrescarPantalla(void * object) {
+    DisplayRefresh(object);
+    LatencyShown(latencia, DisplayGetShownFrame(object));
+    if (DisplayGetShownFrame(object) != cuadro_grabado){
+        cuadro_grabado = DisplayGetShownFrame(object);
+        GrabarCuadro(object);
+    }
+}
+
+// Graba el cuadro que acaba de llegar a la pantalla y el estado del reloj en ese momento
+static void GrabarCuadro(display_t display) {
+    uint8_t segmentos[4];
+    uint8_t hora[6];
+    uint8_t alarma[4];
+    uint8_t banderas = 0;
+    uint32_t valor = 0;
+
+    DisplayReadFrame(display, segmentos, sizeof(segmentos));
+    for (uint8_t digito = 0; digito < sizeof(segmentos); digito++){
+        valor |= (uint32_t) segmentos[digito] << (8 * digito);
+    }
+    RecordEvent(tick_actual, RECORD_FRAME, 0, valor);
+
+    if (ClockGetTime(reloj, hora, sizeof(hora))) banderas |= RECORD_CLOCK_VALID;
+    if (ClockGetAlarm(reloj, alarma, sizeof(alarma))) banderas |= RECORD_CLOCK_ALARM;
+    RecordEvent(tick_actual, RECORD_CLOCK, banderas, BcdPack(hora, sizeof(hora)));
+}
+
+// Graba la vuelta del lazo principal que termino desde el tick anterior, antes de contar el proximo
+static void GrabarLazo(void) {
+    uint32_t vueltas = vueltas_lazo;
+
+    if (vueltas != vueltas_grabadas){
+        vueltas_grabadas = vueltas;
+        RecordLoop(tick_actual);
+    }
+}
+
+static void AvanzarParpadeo(void * object) {
+    DisplayBlinkTick(object);
+}
+
+static void AtenuarPantalla(void * object) {
+    DisplayDimTick(object);
+}
+
+static void AvanzarZumbador(void * object) {
+    BuzzerTick(object);
+}
+
+// Captura el reloj en el flanco del pulso, solo se guarda el primero hasta que el lazo principal lo procese
+static void MuestrearPulso(void * object) {
+    if (DigitalInputHasActivated(board->pps) && !hay_pulso){
+        DisciplineCapture(object, &pulso);
+        hay_pulso = true;
+    }
+}
+
+static void MuestrearTeclas(void * object) {
+    for (uint8_t tecla = 0; tecla < LATENCY_KEYS; tecla++){
+        bool estado = DigitalInputGetRawState(teclas[tecla]);
+
+        LatencySample(object, tecla, estado);
+        if (estado != ((teclas_presionadas >> tecla) & 1)){
+            teclas_presionadas ^= 1 << tecla;
+            RecordEvent(tick_actual, RECORD_KEY, tecla, estado);
+        }
+    }
+}
+
+static void FiltrarTeclas(void * object) {
+    digital_input_t * entradas = object;
+
+    for (uint8_t tecla = 0; tecla < LATENCY_KEYS; tecla++){
+        DigitalInputDebounce(entradas[tecla]);
+    }
+}
+
+// Registra la tecla en la traza y cierra la espera del lazo principal en la medicion de demora
+static void AtenderTecla(trace_key_t tecla) {
+    TraceRecord(TRACE_EVENT_KEY, tecla);
+    LatencyHandled(latencia, tecla, modo);
+}
+
+static void MostrarHora(void) {
+    uint8_t hora[4];
+
+    if(modo <= MOSTRANDO_HORA){
+        /*Obtenemos la hora actual*/
+        ClockGetTime(reloj, hora, sizeof(hora));
+        /*Solo se reescribe la capa de digitos cuando cambia la hora mostrada*/
+        if(memcmp(hora, mostrada, sizeof(hora)) != 0){
+            memcpy(mostrada, hora, sizeof(mostrada));
+            DisplayWriteBCD(board->display, hora, sizeof(hora));
+        }
+    }
+}
+
+/* El cronometro y el temporizador se calculan del contador de milisegundos solo al mostrarlos */
+static void MostrarCronometro(void) {
+    if(modo == CRONOMETRO){
+        MostrarDuracion(StopwatchGetElapsed(cronometro));
+    }else if(modo == TEMPORIZADOR){
+        MostrarDuracion(CountdownGetRemaining(temporizador));
+    }
+}
+
+/* Segundos y centesimas durante el primer minuto, despues minutos y segundos y pasada la hora
+   horas y minutos. Solo se reescribe la pantalla cuando cambian las centesimas */
+static void MostrarDuracion(uint32_t milisegundos) {
+    uint32_t centesimas = milisegundos / 10;
+
+    if(centesimas != duracion_mostrada){
+        duracion_mostrada = centesimas;
+        if(milisegundos < 60000){
+            DisplayWriteTime(board->display, milisegundos / 1000, centesimas % 100);
+        }else if(milisegundos < 3600000){
+            DisplayWriteTime(board->display, milisegundos / 60000, milisegundos / 1000 % 60);
+        }else{
+            DisplayWriteTime(board->display, milisegundos / 3600000 % 100, milisegundos / 60000 % 60);
+        }
+    }
+}
+
+/* Suma o resta un paso a la duracion del temporizador detenido, sin pasar de los limites */
+static void AjustarTemporizador(bool incrementar) {
+    uint32_t restante = CountdownGetRemaining(temporizador);
+
+    if(!CountdownIsRunning(temporizador)){
+        if(incrementar){
+            restante = (restante + PASO_TEMPORIZADOR < LIMITE_TEMPORIZADOR) ? restante + PASO_TEMPORIZADOR : LIMITE_TEMPORIZADOR;
+        }else{
+            restante = (restante > PASO_TEMPORIZADOR) ? restante - PASO_TEMPORIZADOR : 0;
+        }
+        CountdownSetup(temporizador, restante);
+    }
+}
+
+/* El cronometro y el temporizador siguen contando aunque se deje de mostrarlos */
+static void VolverAHora(void) {
+    if(ClockGetTime(reloj, entrada, sizeof(entrada))){
+        ChangeMode(MOSTRANDO_HORA);
+    }else{
+        ChangeMode(HORA_SIN_AJUSTAR);
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+bool AppInit(board_t placa) {
+    bool registrados = true;
+
+    board = placa;
+    reloj = ClockCreate(FRECUENCIA_RELOJ, AlarmaActivada);
+    cronometro = StopwatchCreate(&milisegundos, FRECUENCIA_MILISEGUNDOS);
+    temporizador = CountdownCreate(&milisegundos, FRECUENCIA_MILISEGUNDOS);
+    for (uint8_t zona = 0; zona < sizeof(ZONAS) / sizeof(ZONAS[0]); zona++){
+        zonas[zona] = ClockViewCreate(reloj, ZONAS[zona].minutos);
+    }
+    ChangeMode(HORA_SIN_AJUSTAR);
+
+    consola = ConsoleCreate(board->serial, COMANDOS, sizeof(COMANDOS) / sizeof(COMANDOS[0]));
+    volcado = 0;
+    fin_volcado = 0;
+    informe_latencia = HISTOGRAMAS_LATENCIA;
+    borrar_latencia = false;
+    disciplina = DisciplineCreate(reloj, FRECUENCIA_RELOJ);
+    ambiente = AmbientCreate(board->light, DISPLAY_BRIGHTNESS_LEVELS - BRILLO_MINIMO);
+
+    latencia = LatencyCreate();
+    RecordStart(APP_TICKS_PER_SECOND);
+    tick_actual = 0;
+    vueltas_lazo = 0;
+    vueltas_grabadas = 0;
+    teclas_presionadas = 0;
+    cuadro_grabado = UINT32_MAX;
+    teclas[TRACE_KEY_SET_TIME] = board->setTime;
+    teclas[TRACE_KEY_SET_ALARM] = board->setAlarm;
+    teclas[TRACE_KEY_DECREMENT] = board->decrement;
+    teclas[TRACE_KEY_INCREMENT] = board->increment;
+    teclas[TRACE_KEY_ACCEPT] = board->accept;
+    teclas[TRACE_KEY_CANCEL] = board->cancel;
+
+    ticker = TickerCreate(APP_TICKS_PER_SECOND);
+    registrados &= TickerAttachCatchUp(ticker, FRECUENCIA_MILISEGUNDOS, ContarMilisegundos, RecuperarMilisegundos, NULL);
+    registrados &= TickerAttachCatchUp(ticker, FRECUENCIA_RELOJ, AvanzarReloj, RecuperarReloj, reloj);
+    /* Con mas digitos el barrido es mas rapido y quedan menos ticks por turno para regular el brillo */
+    registrados &= TickerAttach(ticker, DisplayScanRate(board->display, APP_TICKS_PER_SECOND), RefrescarPantalla,
+        board->display);
+    /* Se despacha despues del refresco, el turno de cada digito empieza en el mismo tick que lo enciende */
+    registrados &= TickerAttach(ticker, FRECUENCIA_ATENUACION, AtenuarPantalla, board->display);
+    registrados &= TickerAttach(ticker, FRECUENCIA_PARPADEO, AvanzarParpadeo, board->display);
+    registrados &= TickerAttach(ticker, FRECUENCIA_ZUMBADOR, AvanzarZumbador, board->buzzer);
+    registrados &= TickerAttach(ticker, FRECUENCIA_PULSO, MuestrearPulso, disciplina);
+    registrados &= TickerAttach(ticker, FRECUENCIA_ANTIRREBOTE, FiltrarTeclas, teclas);
+    registrados &= TickerAttach(ticker, FRECUENCIA_TECLAS, MuestrearTeclas, latencia);
+    return registrados;
+}
+
+void AppLoop(void) {
+
+    if(DigitalInputHasActivated(board->accept)){
+        AtenderTecla(TRACE_KEY_ACCEPT);
+        if(modo == MOSTRANDO_HORA){
+            if(!ClockGetAlarm(reloj, entrada, sizeof(entrada))){
+                ClockToggleAlarm(reloj);
+                MostrarPuntos();
+            }
+        }else if(modo == AJUSTANDO_MINUTOS_ACTUAL){
+            ChangeMode(AJUSTANDO_HORAS_ACTUAL);
+        }else if(modo == AJUSTANDO_HORAS_ACTUAL){
+            ClockSetupTime(reloj, entrada, sizeof(entrada));
+            ChangeMode(MOSTRANDO_HORA);
+        }else if(modo == AJUSTANDO_MINUTOS_ALARMA){
+            ChangeMode(AJUSTANDO_HORAS_ALARMA);
+        }else if(modo == AJUSTANDO_HORAS_ALARMA){
+            ClockSetupAlarm(reloj, entrada, sizeof(entrada));
+            ChangeMode(MOSTRANDO_HORA);
+        }else if(modo == CRONOMETRO){
+            if(StopwatchIsRunning(cronometro)){
+                StopwatchStop(cronometro);
+            }else{
+                StopwatchStart(cronometro);
+            }
+        }else if(modo == TEMPORIZADOR){
+            if(CountdownIsRunning(temporizador)){
+                CountdownStop(temporizador);
+            }else{
+                CountdownStart(temporizador);
+            }
+        }
+    }
+    if(DigitalInputHasActivated(board->cancel)){
+        AtenderTecla(TRACE_KEY_CANCEL);
+        if(aviso_temporizador && (modo <= MOSTRANDO_HORA)){
+            /* Silenciar el aviso del temporizador consume la tecla sin cambiar la alarma */
+            BuzzerStop(board->buzzer);
+            aviso_temporizador = false;
+        }else if(modo == MOSTRANDO_HORA){
+            BuzzerStop(board->buzzer);
+            DisplayBlinkSegments(board->display, PARPADEO_ALARMA, 3, 3, SEGMENT_P, 0);
+            if(ClockGetAlarm(reloj, entrada, sizeof(entrada))){
+                ClockToggleAlarm(reloj);
+                MostrarPuntos();
+            }
+        }else if((modo == CRONOMETRO) && !StopwatchIsRunning(cronometro) && StopwatchGetElapsed(cronometro)){
+            /* Con el cronometro detenido la primera cancelacion lo pone en cero y la segunda sale */
+            StopwatchReset(cronometro);
+        }else if(modo == TEMPORIZADOR){
+            BuzzerStop(board->buzzer);
+            aviso_temporizador = false;
+            VolverAHora();
+        }else{
+            VolverAHora();
+        }
+    }
+    if(DigitalInputHasActivated(board->setTime)){
+        AtenderTecla(TRACE_KEY_SET_TIME);
+        ChangeMode(AJUSTANDO_MINUTOS_ACTUAL);
+        ClockGetTime(reloj, entrada, sizeof(entrada));
+        DisplayWriteBCD(board->display, entrada, sizeof(entrada));
+    }
+    if(DigitalInputHasActivated(board->setAlarm)){
+        AtenderTecla(TRACE_KEY_SET_ALARM);
+        ChangeMode(AJUSTANDO_MINUTOS_ALARMA);
+        ClockGetAlarm(reloj, entrada, sizeof(entrada));
+        DisplayWriteBCD(board->display, entrada, sizeof(entrada));
+    }
+
+    if(DigitalInputHasRepeated(board->decrement, milisegundos)){
+        AtenderTecla(TRACE_KEY_DECREMENT);
+        if((modo == AJUSTANDO_MINUTOS_ACTUAL) || (modo == AJUSTANDO_MINUTOS_ALARMA)){
+            AjustarEntrada(CAMPO_MINUTOS, LIMITE_MINUTOS, false);
+        } else if((modo == AJUSTANDO_HORAS_ACTUAL) || (modo == AJUSTANDO_HORAS_ALARMA)){
+            AjustarEntrada(CAMPO_HORAS, LIMITE_HORAS, false);
+        } else if(modo == TEMPORIZADOR){
+            AjustarTemporizador(false);
+        } else if(modo <= MOSTRANDO_HORA){
+            ChangeMode(TEMPORIZADOR);
+        }
+        if((modo > MOSTRANDO_HORA) && (modo <= AJUSTANDO_HORAS_ALARMA)){
+            DisplayWriteBCD(board->display, entrada, sizeof(entrada));
+        }
+    }
+    if(DigitalInputHasRepeated(board->increment, milisegundos)){
+        AtenderTecla(TRACE_KEY_INCREMENT);
+        if((modo == AJUSTANDO_MINUTOS_ACTUAL) || (modo == AJUSTANDO_MINUTOS_ALARMA)){
+            AjustarEntrada(CAMPO_MINUTOS, LIMITE_MINUTOS, true);
+        } else if((modo == AJUSTANDO_HORAS_ACTUAL) || (modo == AJUSTANDO_HORAS_ALARMA)){
+            AjustarEntrada(CAMPO_HORAS, LIMITE_HORAS, true);
+        } else if(modo == TEMPORIZADOR){
+            AjustarTemporizador(true);
+        } else if(modo <= MOSTRANDO_HORA){
+            ChangeMode(CRONOMETRO);
+        }
+        if((modo > MOSTRANDO_HORA) && (modo <= AJUSTANDO_HORAS_ALARMA)){
+            DisplayWriteBCD(board->display, entrada, sizeof(entrada));
+        }
+    }
+
+    if(CountdownHasExpired(temporizador)){
+        BuzzerStart(board->buzzer);
+        aviso_temporizador = true;
+    }
+
+    if(alarma_disparada){
+        alarma_disparada = false;
+        DisplayBlinkSegments(board->display, PARPADEO_ALARMA, 3, 3, SEGMENT_P, PERIODO_ALARMA);
+    }
+
+    if(hay_pulso){
+        DisciplinePulse(disciplina, &pulso);
+        hay_pulso = false;
+    }
+
+    ConsolePoll(consola);
+    VolcarTraza();
+    VolcarLatencia();
+
+    if (AmbientUpdate(ambiente)){
+        DisplaySetBrightness(board->display, BRILLO_MINIMO + AmbientGetLevel(ambiente));
+    }
+
+    /* Toda la composicion de la pantalla ocurre en el lazo principal y se publica de una sola vez */
+    MostrarHora();
+    MostrarCronometro();
+    DisplayCommit(board->display);
+    LatencyCommitted(latencia, DisplayGetFrame(board->display));
+
+    /* Solo escribe el lazo, la interrupcion la lee para grabar la vuelta */
+    vueltas_lazo = vueltas_lazo + 1;
+}
+
+void AppTick(void) {
+    TraceRecord(TRACE_EVENT_TICK, (uint16_t) milisegundos);
+    GrabarLazo();
+    tick_actual++;
+    TickerDispatch(ticker);
+}
+
+void AppCatchUp(uint32_t ticks) {
+    GrabarLazo();
+    RecordEvent(tick_actual, RECORD_LOST, 0, ticks);
+    tick_actual += ticks;
+    TickerSkip(ticker, ticks);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,124 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bcd.c
+ **
+ ** @brief Aritmetica BCD empaquetada
+ **
+ ** Sumas y restas SWAR (SIMD dentro de un registro) sobre digitos BCD empaquetados
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup bcd BCD empaquetado
+ ** @brief Aritmetica BCD empaquetada
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "bcd.h"
+
+/* === Definicion y Macros privados ======================================== */
+
+// Suma seis a cada digito, asi los digitos que superan nueve desbordan el nibble como en binario
+#define SIXES 0x06666666
+
+// Bit menos significativo de cada nibble que puede recibir un acarreo o un prestamo
+#define NIBBLE_CARRIES 0x11111110
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+/* === Definiciones de variables privadas ================================== */
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+/* === Definiciones de funciones privadas ================================== */
+
+/* === Definiciones de funciones publicas ================================== */
+
+bcd_t BcdPack(uint8_t const * digits, uint8_t size){
+    bcd_t value = 0;
+
+    for (uint8_t index = 0; index < size; index++){
+        value = (value << 4) | digits[index];
+    }
+    return value;
+}
+
+void BcdUnpack(bcd_t value, uint8_t * digits, uint8_t size){
+    for (uint8_t index = size; index > 0; index--){
+        digits[index - 1] = value & 0x0F;
+        value >>= 4;
+    }
+}
+
+bcd_t BcdAdd(bcd_t a, bcd_t b){
+    uint32_t biased = a + SIXES;
+    uint32_t sum = biased + b;
+    /* Los nibbles que no generaron acarreo conservan el seis agregado y se lo quita */
+    uint32_t carries = (sum ^ biased ^ b) & NIBBLE_CARRIES;
+    uint32_t kept = ~carries & NIBBLE_CARRIES;
+
+    return sum - ((kept >> 2) | (kept >> 3));
+}
+
+bcd_t BcdSub(bcd_t a, bcd_t b){
+    uint32_t difference = a - b;
+    /* Los nibbles que pidieron prestamo quedaron desplazados en seis respecto de la base diez */
+    uint32_t borrows = (a ^ b ^ difference) & NIBBLE_CARRIES;
+
+    return difference - ((borrows >> 2) | (borrows >> 3));
+}
+
+bcd_t BcdAddMod(bcd_t a, bcd_t b, bcd_t limit){
+    bcd_t sum = BcdAdd(a, b);
+
+    return (sum >= limit) ? BcdSub(sum, limit) : sum;
+}
+
+bcd_t BcdSubMod(bcd_t a, bcd_t b, bcd_t limit){
+    return (a >= b) ? BcdSub(a, b) : BcdSub(limit, BcdSub(b, a));
+}
+
+int BcdCompare(bcd_t a, bcd_t b){
+    return (a > b) - (a < b);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -54,10 +54,34 @@
 #include "chip.h"
 #include "bsp.h"
 #include "poncho.h"
+#include "max7219.h"
+#include "pin.h"
+#include "shift.h"
 
 /* === Definicion y Macros privados ======================================== */
 
-
+/* Si se define SHIFT_DISPLAY_DIGITS la pantalla es una cadena de 74HC595 en el conector SPI: el primer
+   registro tiene los segmentos y los siguientes un bit por digito, empezando por el digito cero */
+#ifdef SHIFT_DISPLAY_DIGITS
+    #if (SHIFT_DISPLAY_DIGITS > SHIFT_MAX_DIGITS)
+        #error "La cadena de registros tiene mas digitos que SHIFT_MAX_DIGITS"
+    #endif
+#endif
+
+/* Si se define MAX7219_DISPLAY_DIGITS la pantalla es un controlador MAX7219 en el conector SPI, que
+   multiplexa por su cuenta y solo recibe los digitos que cambian */
+#ifdef MAX7219_DISPLAY_DIGITS
+    #if (MAX7219_DISPLAY_DIGITS > MAX7219_DIGITS)
+        #error "Un controlador MAX7219 maneja hasta ocho digitos"
+    #endif
+
+    // Palabras que entran en la FIFO de transmision de la SSP
+    #define SPI_FIFO_DEPTH 8
+
+    #if (MAX7219_BURST > SPI_FIFO_DEPTH)
+        #error "Cada refresco de la pantalla tiene que entrar en la FIFO de la SSP"
+    #endif
+#endif
 
 /* === Declaraciones de tipos de datos privados ============================ */
 
@@ -65,121 +89,136 @@ static struct board_s board = {0};
 
 /* === Declaraciones de funciones privadas ================================= */
 
-static void DigitsInit(void);
-static void SegmentsInit(void);
 static void BuzzerInit(void);
+static void BuzzerToneSet(uint16_t frequency, uint8_t volume);
 static void TecsInit(void);
 static void CiaaLedsInit(void);
 static void displayInit(void);
+static void SerialInit(void);
+static void SerialStart(uint8_t * buffer, uint16_t size);
+static uint16_t SerialReceived(void);
+static void SerialSend(uint8_t const * data, uint16_t size);
+static bool SerialSending(void);
+static void LightInit(void);
+static void LightStart(uint32_t * buffer, uint16_t size);
+static uint16_t LightValue(uint32_t sample);
+#if !defined(SHIFT_DISPLAY_DIGITS) && !defined(MAX7219_DISPLAY_DIGITS)
 static void clearScreen(void);
 static void WriteNumber(uint8_t number);
 static void SelectDigit(uint8_t digit);
+#endif
+#ifdef SHIFT_DISPLAY_DIGITS
+static void ShiftInit(void);
+static void ShiftSend(uint8_t const * chain, uint8_t size);
+static void ShiftLatch(void);
+static void ShiftOutputs(bool blank);
+static bool ShiftBusy(void);
+static void ShiftClear(void);
+static bool ShiftDigit(uint8_t digit, uint8_t segments);
+#endif
+#ifdef MAX7219_DISPLAY_DIGITS
+static void ControllerInit(void);
+static void ControllerSend(uint16_t const * words, uint8_t count);
+static void ControllerClear(void);
+static void ControllerWrite(uint8_t const * segments, uint8_t digits);
+static void ControllerBrightness(uint8_t level);
+#endif
 
 /* === Definiciones de variables privadas ================================== */
 
+// Canales de DMA del puerto serie, la recepcion usa un descriptor enlazado consigo mismo para ser circular
+static struct {
+    uint8_t rx_channel;
+    uint8_t tx_channel;
+    uint16_t size;
+    DMA_TransferDescriptor_t descriptor;
+} serial;
+
+// Canal de DMA del sensor de luz, el descriptor enlazado consigo mismo hace circular al buffer
+static struct {
+    uint8_t channel;
+    DMA_TransferDescriptor_t descriptor;
+} light;
+
+#ifdef SHIFT_DISPLAY_DIGITS
+// Cadena de la pantalla y canal del DMA que la envia al SSP
+static shift_t shift;
+
+static uint8_t shift_channel;
+#endif
+
+#ifdef MAX7219_DISPLAY_DIGITS
+// Controlador de la pantalla, con la copia de sus registros de digito
+static max7219_t controller;
+#endif
+
 /* === Definiciones de variables publicas ================================== */
 
 /* === Definiciones de funciones privadas ================================== */
 
-void DigitsInit(void){
-    Chip_SCU_PinMuxSet(DIGIT_1_PORT, DIGIT_1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_1_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, true);
-    
-    Chip_SCU_PinMuxSet(DIGIT_2_PORT, DIGIT_2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_2_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, true);
-
-    Chip_SCU_PinMuxSet(DIGIT_3_PORT, DIGIT_3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_3_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, true);
-
-    Chip_SCU_PinMuxSet(DIGIT_4_PORT, DIGIT_4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_4_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, true);
-}
-
-void SegmentsInit(void){
-    Chip_SCU_PinMuxSet(SEGMENT_A_PORT, SEGMENT_A_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_A_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, true);
-    
-    Chip_SCU_PinMuxSet(SEGMENT_B_PORT, SEGMENT_B_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_B_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, true);
-    
-    Chip_SCU_PinMuxSet(SEGMENT_C_PORT, SEGMENT_C_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_C_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, true);
-    
-    Chip_SCU_PinMuxSet(SEGMENT_D_PORT, SEGMENT_D_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_D_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, true);
-    
-    Chip_SCU_PinMuxSet(SEGMENT_E_PORT, SEGMENT_E_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_E_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, true);
-
-    Chip_SCU_PinMuxSet(SEGMENT_F_PORT, SEGMENT_F_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_F_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, true);
-
-    Chip_SCU_PinMuxSet(SEGMENT_G_PORT, SEGMENT_G_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_G_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, true);
-    
-    Chip_SCU_PinMuxSet(SEGMENT_P_PORT, SEGMENT_P_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_P_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, true);
+void BuzzerInit(void){
+    static const struct buzzer_driver_s buzzer_driver = {
+        .ToneSet = BuzzerToneSet,
+    };
+
+    /* El terminal quedo conectado a la salida del SCT en la tabla, el tono no requiere interrupciones */
+    Chip_SCTPWM_Init(LPC_SCT);
+    Chip_SCTPWM_SetOutPin(LPC_SCT, BUZZER_SCT_INDEX, BUZZER_SCT_OUT);
+
+    board.buzzer = BuzzerCreate(&buzzer_driver);
 }
 
-void BuzzerInit(void){
-    Chip_SCU_PinMuxSet(BUZZER_PORT, BUZZER_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | BUZZER_FUNC);
-    board.buzzer = DigitalOutputCreate(BUZZER_GPIO, BUZZER_BIT);
+void BuzzerToneSet(uint16_t frequency, uint8_t volume){
+    if (frequency && volume){
+        Chip_SCTPWM_SetRate(LPC_SCT, frequency);
+        Chip_SCTPWM_SetDutyCycle(LPC_SCT, BUZZER_SCT_INDEX, Chip_SCTPWM_PercentageToTicks(LPC_SCT, volume));
+        Chip_SCTPWM_Start(LPC_SCT);
+    } else {
+        /* Al detener el contador la salida conserva su nivel, se la fuerza a cero */
+        Chip_SCTPWM_Stop(LPC_SCT);
+        LPC_SCT->OUTPUT &= ~(1 << BUZZER_SCT_OUT);
+    }
 }
 
 void TecsInit(void){
-    Chip_SCU_PinMuxSet(TEC_F1_PORT, TEC_F1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | TEC_F1_FUNC);
     board.setTime = DigitalInputCreate(TEC_F1_GPIO, TEC_F1_BIT, false);
-    
-    Chip_SCU_PinMuxSet(TEC_F2_PORT, TEC_F2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | TEC_F2_FUNC);
     board.setAlarm = DigitalInputCreate(TEC_F2_GPIO, TEC_F2_BIT, false);
-
-    Chip_SCU_PinMuxSet(TEC_F3_PORT, TEC_F3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | TEC_F3_FUNC);
     board.increment = DigitalInputCreate(TEC_F3_GPIO, TEC_F3_BIT, false);
-
-    Chip_SCU_PinMuxSet(TEC_F4_PORT, TEC_F4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | TEC_F4_FUNC);
     board.decrement = DigitalInputCreate(TEC_F4_GPIO, TEC_F4_BIT, false);
-
-    Chip_SCU_PinMuxSet(TEC_ACCEPT_PORT, TEC_ACCEPT_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | TEC_ACCEPT_FUNC);
     board.accept = DigitalInputCreate(TEC_ACCEPT_GPIO, TEC_ACCEPT_BIT, false);
-
-    Chip_SCU_PinMuxSet(TEC_CANCEL_PORT, TEC_CANCEL_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | TEC_CANCEL_FUNC);
     board.cancel = DigitalInputCreate(TEC_CANCEL_GPIO, TEC_CANCEL_BIT, false);
+    board.pps = DigitalInputCreate(PPS_GPIO, PPS_BIT, false);
 }
 
 void CiaaLedsInit(void){
-    Chip_SCU_PinMuxSet(LED_R_PORT, LED_R_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_R_FUNC);
     board.ledRed = DigitalOutputCreate(LED_R_GPIO, LED_R_BIT);
-
-    Chip_SCU_PinMuxSet(LED_G_PORT, LED_G_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_G_FUNC);
     board.ledGreen = DigitalOutputCreate(LED_G_GPIO, LED_G_BIT);
-
-    Chip_SCU_PinMuxSet(LED_B_PORT, LED_B_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_B_FUNC);
     board.ledBlue = DigitalOutputCreate(LED_B_GPIO, LED_B_BIT);
-
-    Chip_SCU_PinMuxSet(LED_1_PORT, LED_1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_1_FUNC);
     board.ledRojo = DigitalOutputCreate(LED_1_GPIO, LED_1_BIT);
-
-    Chip_SCU_PinMuxSet(LED_2_PORT, LED_2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_2_FUNC);
     board.ledAmar = DigitalOutputCreate(LED_2_GPIO, LED_2_BIT);
-
-    Chip_SCU_PinMuxSet(LED_3_PORT, LED_3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_3_FUNC);
     board.ledVerde = DigitalOutputCreate(LED_3_GPIO, LED_3_BIT);
 }
 
 void displayInit(void){
+#ifdef SHIFT_DISPLAY_DIGITS
+    static const struct display_driver_s display_driver = {
+        .ScreenTurnOff = ShiftClear,
+        .ScanDigit = ShiftDigit,
+    };
+
+    ShiftInit();
+    board.display = DisplayCreate(SHIFT_DISPLAY_DIGITS, &display_driver);
+#elif defined(MAX7219_DISPLAY_DIGITS)
+    static const struct display_driver_s display_driver = {
+        .ScreenTurnOff = ControllerClear,
+        .WriteFrame = ControllerWrite,
+        .SetBrightness = ControllerBrightness,
+    };
 
+    ControllerInit();
+    controller = Max7219Create(MAX7219_DISPLAY_DIGITS, ControllerSend);
+    board.display = DisplayCreate(MAX7219_DISPLAY_DIGITS, &display_driver);
+#else
     static const struct display_driver_s display_driver = {
         .ScreenTurnOff = clearScreen,
         .ScreenTurnOn = WriteNumber,
@@ -187,50 +226,195 @@ void displayInit(void){
     };
 
     board.display = DisplayCreate(4, &display_driver);
+#endif
+}
+
+void SerialInit(void){
+    static const struct serial_driver_s serial_driver = {
+        .Start = SerialStart,
+        .Received = SerialReceived,
+        .Send = SerialSend,
+        .Sending = SerialSending,
+    };
+
+    Chip_UART_Init(UART_USB);
+    Chip_UART_SetBaud(UART_USB, UART_USB_BAUDRATE);
+    Chip_UART_ConfigData(UART_USB, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+    /* Las solicitudes de DMA salen de la FIFO, la UART no genera interrupciones */
+    Chip_UART_SetupFIFOS(UART_USB, UART_FCR_FIFO_EN | UART_FCR_DMAMODE_SEL | UART_FCR_TRG_LEV0);
+    Chip_UART_TXEnable(UART_USB);
+
+    serial.rx_channel = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, UART_USB_DMA_RX);
+    serial.tx_channel = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, UART_USB_DMA_TX);
+
+    board.serial = &serial_driver;
+}
+
+void SerialStart(uint8_t * buffer, uint16_t size){
+    serial.size = size;
+    Chip_GPDMA_InitDescriptor(LPC_GPDMA, &serial.descriptor, UART_USB_DMA_RX, (uint32_t) buffer, size,
+        GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA, &serial.descriptor);
+    Chip_GPDMA_SGTransfer(LPC_GPDMA, serial.rx_channel, &serial.descriptor, GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA);
+}
+
+// La posicion de escritura se deduce de la cantidad de transferencias que le faltan al canal
+uint16_t SerialReceived(void){
+    uint16_t remaining = LPC_GPDMA->CH[serial.rx_channel].CONTROL & GPDMA_DMACCxControl_TransferSize(0xFFF);
+
+    return (serial.size - remaining) % serial.size;
+}
+
+void SerialSend(uint8_t const * data, uint16_t size){
+    Chip_GPDMA_Transfer(LPC_GPDMA, serial.tx_channel, (uint32_t) data, UART_USB_DMA_TX,
+        GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, size);
+}
+
+bool SerialSending(void){
+    return (LPC_GPDMA->ENBLDCHNS & (1 << serial.tx_channel)) != 0;
 }
 
+void LightInit(void){
+    static const struct light_driver_s light_driver = {
+        .Start = LightStart,
+        .Value = LightValue,
+        .full_scale = 1023,
+    };
+    ADC_CLOCK_SETUP_T setup;
+
+    /* En modo rafaga el ADC convierte sin pausa y cada resultado pide una transferencia de DMA. La
+       interrupcion del canal solo habilita esa solicitud, no se habilita en el NVIC */
+    Chip_ADC_Init(LIGHT_ADC, &setup);
+    Chip_ADC_SetSampleRate(LIGHT_ADC, &setup, LIGHT_SAMPLE_RATE);
+    Chip_ADC_EnableChannel(LIGHT_ADC, LIGHT_CHANNEL, ENABLE);
+    Chip_ADC_Int_SetChannelCmd(LIGHT_ADC, LIGHT_CHANNEL, ENABLE);
+
+    light.channel = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, LIGHT_DMA);
+
+    board.light = &light_driver;
+}
+
+void LightStart(uint32_t * buffer, uint16_t size){
+    Chip_GPDMA_InitDescriptor(LPC_GPDMA, &light.descriptor, LIGHT_DMA, (uint32_t) buffer, size,
+        GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA, &light.descriptor);
+    Chip_GPDMA_SGTransfer(LPC_GPDMA, light.channel, &light.descriptor, GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA);
+    Chip_ADC_SetBurstCmd(LIGHT_ADC, ENABLE);
+}
+
+// El DMA copia el registro de datos completo, las posiciones sin conversion quedan en cero
+uint16_t LightValue(uint32_t sample){
+    return ADC_DR_DONE(sample) ? ADC_DR_RESULT(sample) : AMBIENT_NO_SAMPLE;
+}
+
+#if !defined(SHIFT_DISPLAY_DIGITS) && !defined(MAX7219_DISPLAY_DIGITS)
 void clearScreen(void){
     Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
     Chip_GPIO_ClearValue(LPC_GPIO_PORT, SEGMENTS_GPIO, SEGMENTS_MASK);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
+    PIN_DEACTIVATE(SEGMENT_P);
 };
 
 void WriteNumber(uint8_t segments){
     Chip_GPIO_SetValue(LPC_GPIO_PORT, SEGMENTS_GPIO, (segments)&SEGMENTS_MASK);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, (segments & SEGMENT_P));
+    PIN_WRITE(SEGMENT_P, (segments & SEGMENT_P) != 0);
 };
 
 void SelectDigit(uint8_t digit){
     Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, (1 << ( 3 - digit)) & DIGITS_MASK );
 };
+#endif
+
+#ifdef SHIFT_DISPLAY_DIGITS
+void ShiftInit(void){
+    static const struct shift_driver_s shift_driver = {
+        .Send = ShiftSend,
+        .Latch = ShiftLatch,
+        .Blank = ShiftOutputs,
+        .Busy = ShiftBusy,
+    };
+
+    Chip_SSP_Init(SPI_SSP);
+    Chip_SSP_SetFormat(SPI_SSP, SSP_BITS_8, SSP_FRAMEFORMAT_SPI, SSP_CLOCK_CPHA0_CPOL0);
+    Chip_SSP_SetBitRate(SPI_SSP, SPI_BITRATE);
+    Chip_SSP_Enable(SPI_SSP);
+    Chip_SSP_DMA_Enable(SPI_SSP);
+
+    shift_channel = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, SPI_DMA_TX);
+    shift = ShiftCreate(SHIFT_DISPLAY_DIGITS, &shift_driver);
+}
+
+void ShiftSend(uint8_t const * chain, uint8_t size){
+    Chip_GPDMA_Transfer(LPC_GPDMA, shift_channel, (uint32_t) chain, SPI_DMA_TX,
+        GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, size);
+}
+
+void ShiftLatch(void){
+    PIN_ACTIVATE(SHIFT_LATCH);
+    PIN_DEACTIVATE(SHIFT_LATCH);
+}
+
+void ShiftOutputs(bool blank){
+    PIN_WRITE(SHIFT_BLANK, blank);
+}
+
+// El canal del DMA termina cuando el ultimo byte entra en la FIFO, el SSP sigue ocupado hasta desplazarlo
+bool ShiftBusy(void){
+    return (Chip_GPDMA_IntGetStatus(LPC_GPDMA, GPDMA_STAT_ENABLED_CH, shift_channel) == SET) ||
+        (Chip_SSP_GetStatus(SPI_SSP, SSP_STAT_BSY) == SET);
+}
+
+void ShiftClear(void){
+    ShiftBlank(shift);
+}
+
+bool ShiftDigit(uint8_t digit, uint8_t segments){
+    return ShiftScan(shift, digit, segments);
+}
+#endif
+
+#ifdef MAX7219_DISPLAY_DIGITS
+void ControllerInit(void){
+    Chip_SSP_Init(SPI_SSP);
+    Chip_SSP_SetFormat(SPI_SSP, SSP_BITS_16, SSP_FRAMEFORMAT_SPI, SSP_CLOCK_CPHA0_CPOL0);
+    Chip_SSP_SetBitRate(SPI_SSP, SPI_BITRATE);
+    Chip_SSP_Enable(SPI_SSP);
+}
+
+/* Las palabras van directo a la FIFO de transmision. Los refrescos envian a lo sumo MAX7219_BURST
+   palabras por interrupcion, asi que solo Max7219Clear, al iniciar la pantalla, puede esperar */
+void ControllerSend(uint16_t const * words, uint8_t count){
+    for (uint8_t index = 0; index < count; index++){
+        while (Chip_SSP_GetStatus(SPI_SSP, SSP_STAT_TNF) == RESET) {}
+        Chip_SSP_SendFrame(SPI_SSP, words[index]);
+    }
+}
+
+void ControllerClear(void){
+    Max7219Clear(controller);
+}
+
+void ControllerWrite(uint8_t const * segments, uint8_t digits){
+    Max7219Write(controller, segments, digits);
+}
+
+void ControllerBrightness(uint8_t level){
+    Max7219SetBrightness(controller, level);
+}
+#endif
 
 /* === Definiciones de funciones publicas ================================== */
 
 board_t BoardCreate(void){
-    DigitsInit();
-    SegmentsInit();
+    PinsInit();
     BuzzerInit();
     TecsInit();
     CiaaLedsInit();
+    /* La pantalla, el puerto serie y el sensor de luz comparten el controlador de DMA */
+    Chip_GPDMA_Init(LPC_GPDMA);
     displayInit();
+    SerialInit();
+    LightInit();
     return &board;
 }
 
-void SisTick_Init(uint16_t ticks) {
-    /* Desactivamos las interrupciones*/
-    __asm volatile("cpsid i");
-
-    /* Activamos el Systick*/
-    SystemCoreClockUpdate();
-    SysTick_Config(SystemCoreClock/ticks);
-
-    /* Actualizamos la prioridad de la Int. */
-    NVIC_SetPriority(SysTick_IRQn, (1 <<__NVIC_PRIO_BITS) - 1);
-
-    /* Activamos las interrupciones*/
-    __asm volatile("cpsie i");
-}
-
 /* === Ciere de documentacion ============================================== */
 
 /** @} Final de la definición del modulo para doxygen */
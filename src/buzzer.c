@@ -0,0 +1,177 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file buzzer.c
+ **
+ ** @brief Zumbador de la alarma con tono generado por hardware
+ **
+ ** Cadencia de pitidos con volumen creciente, avanzada a baja frecuencia
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup buzzer Zumbador
+ ** @brief Zumbador de la alarma
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "buzzer.h"
+#include <stddef.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Frecuencia del tono en Hz
+#ifndef BUZZER_TONE
+    #define BUZZER_TONE 2000
+#endif
+
+// Repeticiones completas de la cadencia antes de subir un escalon de volumen
+#ifndef BUZZER_CYCLES_PER_LEVEL
+    #define BUZZER_CYCLES_PER_LEVEL 4
+#endif
+
+// Convierte una duracion en milisegundos a llamadas de BuzzerTick, se resuelve al compilar
+#define TICKS(ms) ((ms) * BUZZER_TICK_RATE / 1000)
+
+#define ELEMENTS(array) (sizeof(array) / sizeof(array[0]))
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+// Paso de la cadencia, con tono o en silencio
+struct buzzer_step_s {
+    bool tone;          //!< El zumbador suena durante el paso
+    uint8_t duration;   //!< Duracion del paso en llamadas a BuzzerTick
+};
+
+struct buzzer_s {
+    volatile bool ringing;
+    volatile bool start;    //!< Pedido de comenzar la cadencia, lo atiende BuzzerTick
+    uint8_t step;       //!< Paso actual de la cadencia
+    uint8_t count;      //!< Llamadas que faltan para pasar al siguiente paso
+    uint8_t level;      //!< Escalon de volumen actual
+    uint8_t cycles;     //!< Repeticiones de la cadencia con el volumen actual
+    struct buzzer_driver_s driver;
+};
+
+/* === Definiciones de variables privadas ================================== */
+
+static struct buzzer_s instances;
+
+// Cuatro pitidos cortos seguidos de una pausa
+static const struct buzzer_step_s PATTERN[] = {
+    {true, TICKS(100)}, {false, TICKS(100)},
+    {true, TICKS(100)}, {false, TICKS(100)},
+    {true, TICKS(100)}, {false, TICKS(100)},
+    {true, TICKS(100)}, {false, TICKS(600)},
+};
+
+// Escalones de volumen, como ciclo de trabajo en porcentaje de la salida del temporizador
+static const uint8_t VOLUMES[] = {10, 20, 35, 50};
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static void StepEnter(buzzer_t buzzer);
+
+/* === Definiciones de funciones privadas ================================== */
+
+// Programa el tono del paso actual y carga su duracion
+static void StepEnter(buzzer_t buzzer){
+    const struct buzzer_step_s * step = &PATTERN[buzzer->step];
+
+    buzzer->count = step->duration;
+    buzzer->driver.ToneSet(step->tone ? BUZZER_TONE : 0, VOLUMES[buzzer->level]);
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+buzzer_t BuzzerCreate(buzzer_driver_t driver){
+    buzzer_t buzzer = &instances;
+
+    buzzer->driver.ToneSet = driver->ToneSet;
+    buzzer->ringing = false;
+    buzzer->start = false;
+    buzzer->driver.ToneSet(0, 0);
+
+    return buzzer;
+}
+
+/* Se llama desde la interrupcion y desde el lazo principal, solo deja el pedido para que la cadencia
+   se cambie siempre desde BuzzerTick */
+void BuzzerStart(buzzer_t buzzer){
+    buzzer->start = true;
+}
+
+// Con el pedido borrado primero, BuzzerTick no vuelve a encender el tono despues de apagarlo
+void BuzzerStop(buzzer_t buzzer){
+    buzzer->start = false;
+    if (buzzer->ringing){
+        buzzer->ringing = false;
+        buzzer->driver.ToneSet(0, 0);
+    }
+}
+
+bool BuzzerIsRinging(buzzer_t buzzer){
+    return buzzer->ringing || buzzer->start;
+}
+
+void BuzzerTick(buzzer_t buzzer){
+    if (buzzer->start){
+        buzzer->start = false;
+        buzzer->step = 0;
+        buzzer->level = 0;
+        buzzer->cycles = 0;
+        buzzer->ringing = true;
+        StepEnter(buzzer);
+        return;
+    }
+    if (!buzzer->ringing || (--buzzer->count > 0)) return;
+
+    if (++buzzer->step == ELEMENTS(PATTERN)){
+        buzzer->step = 0;
+        if ((++buzzer->cycles == BUZZER_CYCLES_PER_LEVEL) && (buzzer->level < ELEMENTS(VOLUMES) - 1)){
+            buzzer->cycles = 0;
+            buzzer->level++;
+        }
+    }
+    StepEnter(buzzer);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
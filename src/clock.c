@@ -1,5 +1,7 @@
-#include <string.h>
 #include "clock.h"
+#include "trace.h"
+#include "bcd.h"
+#include <stddef.h>
 
 #define START_VALUE 0
 
@@ -7,119 +9,377 @@
 
 #define ALARM_SIZE 4
 
-#define SECONDS_UNITS 5
+// Valores empaquetados en BCD, la hora se guarda como 0xHHMMSS y la alarma como 0xHHMM
+#define SECONDS_MASK 0x0000FF
 
-#define SECONDS_TENS 4
+#define MINUTES_MASK 0x00FF00
 
-#define MINUTE_UNITS 3
+#define MINUTES_OVERFLOW 0x006000
 
-#define MINUTE_TENS 2
+#define SECONDS_OVERFLOW 0x000060
 
-#define HOURS_UNITS 1
+// Sumado a un campo que llego a 60 lo deja en cero y propaga el acarreo al campo siguiente
+#define CARRY_FROM_60 0x40
 
-#define HOURS_TENS 0
+#define DAY_OVERFLOW 0x240000
 
-#define MAX_HOURS_UNITS_VALUE 4
+#define ALARM_MINUTES_MASK 0xFF
 
-#define MAX_HOURS_TENS_VALUE 2
+#define MINUTES_LIMIT 0x60
+
+#define HOURS_LIMIT 0x24
+
+// Ticks que se puede alargar o acortar cada segundo al corregir la hora sin saltos
+#ifndef CLOCK_SLEW_MAX
+    #define CLOCK_SLEW_MAX 2
+#endif
+
+// Unidades de la correccion de frecuencia, partes por millon
+#define TRIM_SCALE 1000000L
+
+#define SECONDS_PER_HOUR 3600
+
+#define SECONDS_PER_MINUTE 60
+
+#define SECONDS_PER_DAY (24 * SECONDS_PER_HOUR)
+
+// Lectura desde el lazo principal de un campo que cambia la interrupcion, el compilador no la puede reusar
+#define SHARED(field) (*(volatile __typeof__(field) *) &(field))
+
+// Cantidad de vistas desplazadas que se pueden crear sobre los relojes
+#ifndef CLOCK_VIEWS
+    #define CLOCK_VIEWS 4
+#endif
 
 struct clock_s{
     bool valid;
     bool enabled;
     uint16_t ticks_per_second;
     uint16_t ticks_count;
-    uint8_t time[TIME_SIZE];
-    uint8_t alarm[ALARM_SIZE];
+    uint16_t period;        //!< Duracion en ticks del segundo en curso
+    uint32_t slew_target;   //!< Correccion total pedida, solo la escribe el lazo principal
+    uint32_t slewed;        //!< Correccion total aplicada, solo la escribe la interrupcion
+    int32_t trim;           //!< Correccion de frecuencia en partes por millon multiplicada por los ticks por segundo
+    int32_t trim_count;     //!< Acumulador de la correccion de frecuencia
+    bcd_t time;
+    bcd_t alarm;
+    uint32_t days;          //!< Fecha actual como dias desde el 1 de enero de 1970
+    uint8_t weekday;        //!< Dia de la semana de la fecha actual, se avanza junto con la fecha
+    uint8_t alarm_days;     //!< Mascara de los dias de la semana en los que suena la alarma
     clock_event_t event_handler;
 };
 
 static struct clock_s instances;
 
+// Una vista solo guarda su diferencia con el reloj, la hora se calcula al leerla
+struct clock_view_s{
+    bool allocated;
+    clock_t clock;
+    int32_t offset;         //!< Diferencia con el reloj en segundos, menor a un dia
+};
+
+static struct clock_view_s views[CLOCK_VIEWS];
+
+static bcd_t FieldsLoad(bcd_t value, uint8_t digits, uint8_t const * source, uint8_t size);
+
+static void FieldsStore(bcd_t value, uint8_t digits, uint8_t * destination, uint8_t size);
+
+static bcd_t AlarmAdd(bcd_t alarm, bcd_t delay);
+
+static void NextSecond(clock_t clock);
+
+static void NextPeriod(clock_t clock);
+
+static uint32_t TimeToSeconds(bcd_t time);
+
+static bcd_t SecondsToTime(uint32_t seconds);
+
+static uint32_t ViewSeconds(clock_view_t view, uint32_t * days);
+
+// Reemplaza los primeros digitos de un valor empaquetado, como lo haria un memcpy sobre los digitos sueltos
+static bcd_t FieldsLoad(bcd_t value, uint8_t digits, uint8_t const * source, uint8_t size){
+    uint8_t shift;
+
+    if (size > digits) size = digits;
+    shift = 4 * (digits - size);
+    if (size == 0) return value;
+    return (value & ((1UL << shift) - 1)) | (BcdPack(source, size) << shift);
+}
+
+// Copia los primeros digitos de un valor empaquetado a un vector de digitos sueltos
+static void FieldsStore(bcd_t value, uint8_t digits, uint8_t * destination, uint8_t size){
+    if (size > digits) size = digits;
+    BcdUnpack(value >> (4 * (digits - size)), destination, size);
+}
+
+// Suma una demora en horas y minutos a la alarma, con los acarreos de minutos y horas
+static bcd_t AlarmAdd(bcd_t alarm, bcd_t delay){
+    bcd_t minutes = BcdAdd(alarm & ALARM_MINUTES_MASK, delay & ALARM_MINUTES_MASK);
+    bcd_t hours = BcdAdd(alarm >> 8, delay >> 8);
+
+    while (minutes >= MINUTES_LIMIT){
+        minutes = BcdSub(minutes, MINUTES_LIMIT);
+        hours = BcdAdd(hours, 1);
+    }
+    while (hours >= HOURS_LIMIT){
+        hours = BcdSub(hours, HOURS_LIMIT);
+    }
+    return (hours << 8) | minutes;
+}
+
+// Avanza la hora un segundo y verifica la alarma al comenzar cada minuto
+static void NextSecond(clock_t clock){
+    /* Todos los digitos se actualizan con una suma BCD, los acarreos de 60 se resuelven con otra */
+    clock->time = BcdAdd(clock->time, 1);
+    if ((clock->time & SECONDS_MASK) == SECONDS_OVERFLOW){
+        clock->time = BcdAdd(clock->time, CARRY_FROM_60);
+        if ((clock->time & MINUTES_MASK) == MINUTES_OVERFLOW){
+            clock->time = BcdAdd(clock->time, CARRY_FROM_60 << 8);
+            if (clock->time == DAY_OVERFLOW){
+                clock->time = START_VALUE;
+                clock->days++;
+                clock->weekday = (clock->weekday == DATE_SATURDAY) ? DATE_SUNDAY : clock->weekday + 1;
+            }
+        }
+
+        if(clock->enabled && ((clock->time >> 8) == clock->alarm) &&
+            (clock->alarm_days & DATE_WEEKDAY_MASK(clock->weekday))){ 
+            TraceRecord(TRACE_EVENT_ALARM, clock->alarm);
+            clock->event_handler(clock,true); 
+        }
+    }
+}
+
+// Fija la duracion del segundo que comienza con un paso de la correccion pendiente y la de frecuencia
+static void NextPeriod(clock_t clock){
+    int32_t pending = (int32_t)(clock->slew_target - clock->slewed);
+    int32_t step = 0;
+
+    if (pending > CLOCK_SLEW_MAX){
+        step = CLOCK_SLEW_MAX;
+    } else if (pending < -CLOCK_SLEW_MAX){
+        step = -CLOCK_SLEW_MAX;
+    } else {
+        step = pending;
+    }
+    clock->slewed += step;
+
+    clock->trim_count += clock->trim;
+    if (clock->trim_count >= TRIM_SCALE){
+        clock->trim_count -= TRIM_SCALE;
+        step++;
+    } else if (clock->trim_count <= -TRIM_SCALE){
+        clock->trim_count += TRIM_SCALE;
+        step--;
+    }
+
+    /* Un reloj atrasado tiene correccion positiva y acorta el segundo */
+    clock->period = clock->ticks_per_second - step;
+}
+
+static uint32_t TimeToSeconds(bcd_t time){
+    uint8_t digits[TIME_SIZE];
+
+    BcdUnpack(time, digits, sizeof(digits));
+    return (10 * digits[0] + digits[1]) * SECONDS_PER_HOUR + (10 * digits[2] + digits[3]) * SECONDS_PER_MINUTE +
+        10 * digits[4] + digits[5];
+}
+
+static bcd_t SecondsToTime(uint32_t seconds){
+    uint8_t digits[TIME_SIZE];
+    uint8_t fields[] = {seconds / SECONDS_PER_HOUR, seconds / SECONDS_PER_MINUTE % 60, seconds % 60};
+
+    for (uint8_t index = 0; index < sizeof(fields); index++){
+        digits[2 * index] = fields[index] / 10;
+        digits[2 * index + 1] = fields[index] % 10;
+    }
+    return BcdPack(digits, sizeof(digits));
+}
+
+// Segundos desde la medianoche en la vista y la fecha que le corresponde
+static uint32_t ViewSeconds(clock_view_t view, uint32_t * days){
+    bcd_t time;
+    uint32_t date;
+    int32_t seconds;
+
+    /* Si pasa la medianoche entre las dos lecturas se vuelve a leer para no mezclar dias */
+    do {
+        time = SHARED(view->clock->time);
+        date = SHARED(view->clock->days);
+    } while (time != SHARED(view->clock->time));
+
+    seconds = (int32_t) TimeToSeconds(time) + view->offset;
+    if (seconds < 0){
+        seconds += SECONDS_PER_DAY;
+        date--;
+    } else if (seconds >= SECONDS_PER_DAY){
+        seconds -= SECONDS_PER_DAY;
+        date++;
+    }
+    *days = date;
+    return seconds;
+}
+
 clock_t ClockCreate( uint16_t ticks_per_second, clock_event_t event_handler){
     instances.valid = false;
     instances.enabled = false;
     instances.event_handler = event_handler;
     instances.ticks_count = START_VALUE;
     instances.ticks_per_second = ticks_per_second;
-    memset(instances.time, START_VALUE, TIME_SIZE);
+    instances.period = ticks_per_second;
+    instances.slew_target = 0;
+    instances.slewed = 0;
+    instances.trim = 0;
+    instances.trim_count = 0;
+    instances.time = START_VALUE;
+    instances.alarm = START_VALUE;
+    instances.days = START_VALUE;
+    instances.weekday = DateWeekday(START_VALUE);
+    instances.alarm_days = DATE_EVERY_DAY;
     return &instances;
 }
 
 bool ClockGetTime( clock_t clock, uint8_t * time, uint8_t size){
-    memcpy( time, clock->time, size);
+    FieldsStore(clock->time, TIME_SIZE, time, size);
     return clock->valid;
 }
 
 void ClockSetupTime(clock_t clock, uint8_t const * const time, uint8_t size){
-    memcpy( clock->time, time, size);
+    clock->time = FieldsLoad(clock->time, TIME_SIZE, time, size);
     clock->valid = true;
+    /* Un ajuste manual descarta la correccion que estuviera pendiente */
+    clock->slew_target = clock->slewed;
 }
 
-void ClockNewTick(clock_t clock){
-    clock->ticks_count++;
-    if (clock->ticks_count == clock->ticks_per_second){
-        clock->ticks_count = START_VALUE;
-        clock->time[SECONDS_UNITS]++;
-        if (clock->time[SECONDS_UNITS] == 10){
-            clock->time[SECONDS_UNITS] = 0;
-            clock->time[SECONDS_TENS]++;
-            if (clock->time[SECONDS_TENS] == 6){
-                clock->time[SECONDS_TENS] = 0;
-                clock->time[MINUTE_UNITS]++;
-                if (clock->time[MINUTE_UNITS] == 10){
-                    clock->time[MINUTE_UNITS] = 0;
-                    clock->time[MINUTE_TENS]++;
-                    if (clock->time[MINUTE_TENS] == 6){
-                        clock->time[MINUTE_TENS] = 0;
-                        clock->time[HOURS_UNITS]++;
-                        if (clock->time[HOURS_UNITS] == 10){
-                            clock->time[HOURS_UNITS] = 0;
-                            clock->time[HOURS_TENS]++;
-                        }
-                    }
-                }
-            }
-        }
+uint32_t ClockGetTicks(clock_t clock){
+    uint16_t count;
+    bcd_t time;
 
-        bool activate = (clock->time[SECONDS_TENS] == 0) && (clock->time[SECONDS_UNITS] == 0);
+    /* Si llega un tick entre las dos lecturas se vuelve a leer para no mezclar segundos */
+    do {
+        count = SHARED(clock->ticks_count);
+        time = SHARED(clock->time);
+    } while (count != SHARED(clock->ticks_count));
+    return TimeToSeconds(time) * clock->ticks_per_second + count;
+}
 
-        for(int index = 0; index < ALARM_SIZE; index++){
-            if(clock->alarm[index] != clock->time[index]){
-                activate = false;
-                break;
-            }
-        }
+void ClockSetupTicks(clock_t clock, uint32_t ticks){
+    clock->time = SecondsToTime(ticks / clock->ticks_per_second);
+    clock->ticks_count = ticks % clock->ticks_per_second;
+    clock->valid = true;
+    clock->slew_target = clock->slewed;
+}
 
-        if(activate && clock->enabled){ 
-            clock->event_handler(clock,true); 
-        }
+void ClockSlew(clock_t clock, int32_t ticks){
+    clock->slew_target += ticks;
+}
 
-        if(clock->time[HOURS_TENS] == MAX_HOURS_TENS_VALUE){
-            if(clock->time[HOURS_UNITS] == MAX_HOURS_UNITS_VALUE){
-                clock->time[HOURS_TENS] = START_VALUE;
-                clock->time[HOURS_UNITS] = START_VALUE;
-            }
-        }
+int32_t ClockGetSlew(clock_t clock){
+    return (int32_t)(clock->slew_target - clock->slewed);
+}
+
+void ClockTrim(clock_t clock, int32_t ppm){
+    clock->trim = ppm * clock->ticks_per_second;
+}
+
+void ClockNewTick(clock_t clock){
+    clock->ticks_count++;
+    if (clock->ticks_count >= clock->period){
+        clock->ticks_count = START_VALUE;
+        NextSecond(clock);
+        NextPeriod(clock);
+    }
+}
+
+void ClockAdvance(clock_t clock, uint32_t ticks){
+    ticks += clock->ticks_count;
+    /* Los segundos completos se avanzan de a uno para no saltear la alarma */
+    while (ticks >= clock->period){
+        ticks -= clock->period;
+        NextSecond(clock);
+        NextPeriod(clock);
     }
+    clock->ticks_count = ticks;
 }
 
 void ClockSetupAlarm(clock_t clock, uint8_t const * const alarm, uint8_t size){
-    memcpy(clock->alarm, alarm, size);
+    clock->alarm = FieldsLoad(clock->alarm, ALARM_SIZE, alarm, size);
     clock->enabled = true;
 }
 
 bool ClockGetAlarm(clock_t clock, uint8_t * alarm, uint8_t size){
-    memcpy(alarm, clock->alarm, size);
+    FieldsStore(clock->alarm, ALARM_SIZE, alarm, size);
     return clock->enabled;
 }
 
+void ClockSetupDate(clock_t clock, uint32_t days){
+    clock->days = days;
+    clock->weekday = DateWeekday(days);
+}
+
+uint32_t ClockGetDate(clock_t clock){
+    return clock->days;
+}
+
+uint8_t ClockGetWeekday(clock_t clock){
+    return clock->weekday;
+}
+
+void ClockSetupAlarmDays(clock_t clock, uint8_t weekdays){
+    clock->alarm_days = weekdays;
+}
+
+uint8_t ClockGetAlarmDays(clock_t clock){
+    return clock->alarm_days;
+}
+
 bool ClockToggleAlarm(clock_t clock){
     clock->enabled = !clock->enabled;
     return clock->enabled;
 }
 
 void ClockPostponeAlarm(clock_t clock, uint8_t const * const postPone_alarm, uint8_t size){
-    clock->alarm[MINUTE_UNITS] = clock->alarm[MINUTE_UNITS] + postPone_alarm[MINUTE_UNITS];
-    clock->alarm[MINUTE_TENS] = clock->alarm[MINUTE_TENS] + postPone_alarm[MINUTE_TENS];
+    clock->alarm = AlarmAdd(clock->alarm, FieldsLoad(START_VALUE, ALARM_SIZE, postPone_alarm, size));
     clock->enabled = true;
 }
+
+clock_view_t ClockViewCreate(clock_t clock, int16_t minutes){
+    clock_view_t view = NULL;
+
+    for (uint8_t index = 0; index < CLOCK_VIEWS; index++){
+        if (!views[index].allocated){
+            view = &views[index];
+            view->allocated = true;
+            view->clock = clock;
+            ClockViewSetOffset(view, minutes);
+            break;
+        }
+    }
+    return view;
+}
+
+void ClockViewSetOffset(clock_view_t view, int16_t minutes){
+    view->offset = (int32_t) minutes * SECONDS_PER_MINUTE % SECONDS_PER_DAY;
+}
+
+int16_t ClockViewGetOffset(clock_view_t view){
+    return view->offset / SECONDS_PER_MINUTE;
+}
+
+bool ClockViewGetTime(clock_view_t view, uint8_t * time, uint8_t size){
+    uint32_t days;
+
+    FieldsStore(SecondsToTime(ViewSeconds(view, &days)), TIME_SIZE, time, size);
+    return view->clock->valid;
+}
+
+uint32_t ClockViewGetDate(clock_view_t view){
+    uint32_t days;
+
+    ViewSeconds(view, &days);
+    return days;
+}
+
+uint8_t ClockViewGetWeekday(clock_view_t view){
+    return DateWeekday(ClockViewGetDate(view));
+}
@@ -0,0 +1,291 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file console.c
+ **
+ ** @brief Consola de comandos sobre un puerto serie con DMA
+ **
+ ** Interpreta lineas de la forma "comando 12:30:00" leyendo el buffer circular de
+ ** recepcion en el lugar, y transmite desde otro buffer circular de a bloques
+ ** contiguos
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup console Consola
+ ** @brief Consola de comandos serie
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "console.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Tamaños de los buffers circulares, deben ser potencias de dos menores a 4096 por el limite del DMA
+#ifndef CONSOLE_RX_SIZE
+    #define CONSOLE_RX_SIZE 256
+#endif
+
+#ifndef CONSOLE_TX_SIZE
+    #define CONSOLE_TX_SIZE 512
+#endif
+
+#define RX_MASK (CONSOLE_RX_SIZE - 1)
+
+#define TX_MASK (CONSOLE_TX_SIZE - 1)
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+struct console_s {
+    struct serial_driver_s driver;
+    console_command_t commands;
+    uint8_t count;
+    uint16_t rx_tail;       //!< Proximo byte recibido que se debe examinar
+    uint16_t line;          //!< Comienzo de la linea en curso dentro del buffer de recepcion
+    uint16_t tx_head;       //!< Posicion en la que se encola el proximo byte
+    uint16_t tx_tail;       //!< Primer byte que todavia no termino de transmitirse
+    uint16_t tx_sending;    //!< Bytes de la transmision por DMA en curso
+    uint8_t rx[CONSOLE_RX_SIZE];
+    uint8_t tx[CONSOLE_TX_SIZE];
+};
+
+// Lectura de una linea en el lugar, sobre el buffer circular
+struct cursor_s {
+    const uint8_t * buffer;
+    uint16_t position;
+    uint16_t end;
+};
+
+/* === Definiciones de variables privadas ================================== */
+
+static struct console_s instances;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static bool IsSeparator(uint8_t character);
+
+static void SkipSeparators(struct cursor_s * cursor);
+
+static bool MatchWord(struct cursor_s * cursor, const char * word);
+
+static void Execute(console_t console, uint16_t start, uint16_t end);
+
+static void Help(console_t console);
+
+static void Transmit(console_t console);
+
+/* === Definiciones de funciones privadas ================================== */
+
+static bool IsSeparator(uint8_t character){
+    return (character == ' ') || (character == ':') || (character == '/') || (character == '-') || (character == '\t');
+}
+
+static void SkipSeparators(struct cursor_s * cursor){
+    while ((cursor->position != cursor->end) && IsSeparator(cursor->buffer[cursor->position])){
+        cursor->position = (cursor->position + 1) & RX_MASK;
+    }
+}
+
+// Compara la palabra siguiente de la linea y solo avanza el cursor si coincide completa
+static bool MatchWord(struct cursor_s * cursor, const char * word){
+    uint16_t position = cursor->position;
+
+    while (*word){
+        if ((position == cursor->end) || (cursor->buffer[position] != (uint8_t) *word)) return false;
+        position = (position + 1) & RX_MASK;
+        word++;
+    }
+    if ((position != cursor->end) && !IsSeparator(cursor->buffer[position])) return false;
+
+    cursor->position = position;
+    return true;
+}
+
+static void Execute(console_t console, uint16_t start, uint16_t end){
+    struct cursor_s cursor = {console->rx, start, end};
+    uint32_t values[CONSOLE_VALUES];
+    uint8_t count = 0;
+    console_command_t command = NULL;
+
+    SkipSeparators(&cursor);
+    if (cursor.position == cursor.end) return;
+
+    if (MatchWord(&cursor, "ayuda")){
+        Help(console);
+        return;
+    }
+    for (uint8_t index = 0; index < console->count; index++){
+        if (MatchWord(&cursor, console->commands[index].name)){
+            command = &console->commands[index];
+            break;
+        }
+    }
+    if (command == NULL){
+        ConsolePrint(console, "comando desconocido, use ayuda\r\n");
+        return;
+    }
+
+    /* Los argumentos se convierten a medida que se leen, sin copiar la linea */
+    for (SkipSeparators(&cursor); cursor.position != cursor.end; SkipSeparators(&cursor)){
+        uint8_t character = cursor.buffer[cursor.position];
+
+        if ((character < '0') || (character > '9') || (count == CONSOLE_VALUES)){
+            ConsolePrint(console, "argumento invalido\r\n");
+            return;
+        }
+        values[count] = 0;
+        while ((cursor.position != cursor.end) && (cursor.buffer[cursor.position] >= '0') &&
+            (cursor.buffer[cursor.position] <= '9')){
+            uint8_t digit = cursor.buffer[cursor.position] - '0';
+
+            /* Un valor que no entra en 32 bits se rechaza en lugar de truncarse en silencio */
+            if (values[count] > (UINT32_MAX - digit) / 10){
+                ConsolePrint(console, "argumento invalido\r\n");
+                return;
+            }
+            values[count] = values[count] * 10 + digit;
+            cursor.position = (cursor.position + 1) & RX_MASK;
+        }
+        count++;
+    }
+    command->handler(console, count, values);
+}
+
+static void Help(console_t console){
+    for (uint8_t index = 0; index < console->count; index++){
+        ConsolePrint(console, console->commands[index].name);
+        ConsolePrint(console, "\t");
+        ConsolePrint(console, console->commands[index].help);
+        ConsolePrint(console, "\r\n");
+    }
+}
+
+// Libera lo que ya se transmitio e inicia la transmision del siguiente bloque contiguo
+static void Transmit(console_t console){
+    uint16_t size;
+
+    if (console->driver.Sending()) return;
+
+    console->tx_tail = (console->tx_tail + console->tx_sending) & TX_MASK;
+    console->tx_sending = 0;
+    if (console->tx_head == console->tx_tail) return;
+
+    size = (console->tx_head > console->tx_tail) ? console->tx_head - console->tx_tail : CONSOLE_TX_SIZE - console->tx_tail;
+    console->tx_sending = size;
+    console->driver.Send(&console->tx[console->tx_tail], size);
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+console_t ConsoleCreate(serial_driver_t driver, console_command_t commands, uint8_t count){
+    console_t console = &instances;
+
+    memcpy(&console->driver, driver, sizeof(console->driver));
+    console->commands = commands;
+    console->count = count;
+    console->rx_tail = 0;
+    console->line = 0;
+    console->tx_head = 0;
+    console->tx_tail = 0;
+    console->tx_sending = 0;
+    console->driver.Start(console->rx, CONSOLE_RX_SIZE);
+
+    return console;
+}
+
+void ConsolePoll(console_t console){
+    uint16_t head = console->driver.Received() & RX_MASK;
+
+    while (console->rx_tail != head){
+        uint8_t character = console->rx[console->rx_tail];
+        uint16_t end = console->rx_tail;
+
+        console->rx_tail = (console->rx_tail + 1) & RX_MASK;
+        if ((character == '\r') || (character == '\n')){
+            Execute(console, console->line, end);
+            console->line = console->rx_tail;
+        } else if (console->rx_tail == console->line){
+            /* La linea ocupa todo el buffer, el DMA ya esta escribiendo sobre su comienzo */
+            ConsolePrint(console, "linea demasiado larga\r\n");
+            console->line = head;
+            console->rx_tail = head;
+        }
+    }
+    Transmit(console);
+}
+
+bool ConsoleWrite(console_t console, uint8_t const * data, uint16_t size){
+    uint16_t first;
+
+    if (size > ConsoleFree(console)) return false;
+
+    first = CONSOLE_TX_SIZE - console->tx_head;
+    if (first > size) first = size;
+    memcpy(&console->tx[console->tx_head], data, first);
+    memcpy(console->tx, data + first, size - first);
+    console->tx_head = (console->tx_head + size) & TX_MASK;
+    return true;
+}
+
+bool ConsolePrint(console_t console, const char * text){
+    return ConsoleWrite(console, (uint8_t const *) text, strlen(text));
+}
+
+bool ConsolePrintNumber(console_t console, uint32_t value, uint8_t digits){
+    uint8_t text[10];
+    uint8_t length = 0;
+
+    do {
+        text[sizeof(text) - 1 - length] = '0' + value % 10;
+        value /= 10;
+        length++;
+    } while ((value > 0) || (length < digits && length < sizeof(text)));
+
+    return ConsoleWrite(console, &text[sizeof(text) - length], length);
+}
+
+uint16_t ConsoleFree(console_t console){
+    return CONSOLE_TX_SIZE - 1 - ((console->tx_head - console->tx_tail) & TX_MASK);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,120 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file date.c
+ **
+ ** @brief Fechas del calendario como cantidad de dias
+ **
+ ** Conversiones entre dias y fechas civiles con eras de 400 años, que tienen
+ ** siempre 146097 dias, y años que comienzan en marzo para dejar el 29 de febrero
+ ** al final
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup date Fechas
+ ** @brief Fechas del calendario
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "date.h"
+#include <stdbool.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Dias de una era de 400 años del calendario gregoriano
+#define DAYS_PER_ERA 146097
+
+// Dias entre el 1 de marzo del año 0 y el 1 de enero de 1970
+#define EPOCH_SHIFT 719468
+
+// Dia de la semana del 1 de enero de 1970
+#define EPOCH_WEEKDAY DATE_THURSDAY
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+/* === Definiciones de variables privadas ================================== */
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+/* === Definiciones de funciones privadas ================================== */
+
+/* === Definiciones de funciones publicas ================================== */
+
+void DateFromDays(uint32_t days, date_t date){
+    uint32_t shifted = days + EPOCH_SHIFT;
+    uint32_t era = shifted / DAYS_PER_ERA;
+    uint32_t day_of_era = shifted - era * DAYS_PER_ERA;
+    /* Corrige los años bisiestos de cada cuatro, cien y cuatrocientos años dentro de la era */
+    uint32_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    uint32_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    /* Meses contados desde marzo, los de marzo a julio y de agosto a diciembre suman 153 dias */
+    uint32_t month = (5 * day_of_year + 2) / 153;
+
+    date->day = day_of_year - (153 * month + 2) / 5 + 1;
+    date->month = (month < 10) ? month + 3 : month - 9;
+    date->year = year_of_era + era * 400 + (date->month <= 2);
+}
+
+uint32_t DateToDays(struct date_s const * date){
+    uint32_t year = date->year - (date->month <= 2);
+    uint32_t era = year / 400;
+    uint32_t year_of_era = year - era * 400;
+    uint32_t day_of_year = (153 * ((date->month > 2) ? date->month - 3 : date->month + 9) + 2) / 5 + date->day - 1;
+    uint32_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+    return era * DAYS_PER_ERA + day_of_era - EPOCH_SHIFT;
+}
+
+uint8_t DateWeekday(uint32_t days){
+    return (days + EPOCH_WEEKDAY) % 7;
+}
+
+uint8_t DateDaysInMonth(uint16_t year, uint8_t month){
+    static const uint8_t DAYS[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    /* Bisiestos cada cuatro años, salvo los seculares que no son multiplo de cuatrocientos */
+    bool leap = ((year % 4) == 0) && (((year % 100) != 0) || ((year % 400) == 0));
+
+    if ((month < 1) || (month > 12)) return 0;
+    return DAYS[month - 1] + ((month == 2) && leap);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -53,6 +53,7 @@
 /* === Inclusiones de cabeceras ============================================ */
 
 #include "digital.h"
+#include "pin.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -65,9 +66,21 @@
 #endif
 
 #ifndef INTPUT_INSTANCES
-    #define INTPUT_INSTANCES 6
+    #define INTPUT_INSTANCES 7
 #endif
 
+// Ticks que debe mantenerse presionada una tecla antes de la primera repeticion
+#ifndef REPEAT_DELAY
+    #define REPEAT_DELAY 500
+#endif
+
+// Muestras consecutivas iguales que se necesitan para aceptar un cambio en una entrada con antirrebote
+#ifndef DIGITAL_DEBOUNCE_SAMPLES
+    #define DIGITAL_DEBOUNCE_SAMPLES 4
+#endif
+
+#define REPEAT_STEPS (sizeof(REPEAT_INTERVALS) / sizeof(REPEAT_INTERVALS[0]))
+
 /* === Declaraciones de tipos de datos privados ============================ */
 
 struct digital_output_s
@@ -84,6 +97,12 @@ struct digital_input_s
     bool allocated;
     bool inverted;
     bool last_state;
+    bool debounced;
+    volatile bool stable;           //!< Estado filtrado, lo escribe la interrupcion
+    uint8_t debounce_count;
+    bool repeat_state;
+    uint8_t repeat_step;
+    uint32_t repeat_next;
 };
 
 /* === Definiciones de variables privadas ================================== */
@@ -91,6 +110,11 @@ struct digital_input_s
 static struct digital_output_s OutputInstances[OUTPUT_INSTANCES] = {0};
 static struct digital_input_s InputInstances[INTPUT_INSTANCES] = {0};
 
+// Intervalos en ticks entre repeticiones sucesivas, el ultimo se mantiene mientras dure la pulsacion
+static const uint16_t REPEAT_INTERVALS[] = {
+    250, 250, 250, 250, 125, 125, 125, 125, 60, 60, 60, 60, 60, 60, 60, 60, 30
+};
+
 /* === Definiciones de variables publicas ================================== */
 
 /* === Declaraciones de funciones privadas ================================= */
@@ -138,23 +162,21 @@ digital_output_t DigitalOutputCreate(uint8_t gpio, uint8_t bit)
     {
         output->gpio = gpio;
         output->bit = bit;
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, output->gpio, output->bit, false);
-        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, output->gpio, output->bit, true);
     }
     return output;
 };
 
 void DigitalOutputActivate(digital_output_t output)
 {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, output->gpio, output->bit, true);
+    PinWrite(output->gpio, output->bit, true);
 };
 void DigitalOutputDeactivate(digital_output_t output)
 {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, output->gpio, output->bit, false);
+    PinWrite(output->gpio, output->bit, false);
 };
 void DigitalOutputToggle(digital_output_t output)
 {
-    Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, output->gpio, output->bit);
+    PinToggle(output->gpio, output->bit);
 };
 
 digital_input_t DigitalInputCreate(uint8_t gpio, uint8_t bit, bool inverted)
@@ -166,13 +188,16 @@ digital_input_t DigitalInputCreate(uint8_t gpio, uint8_t bit, bool inverted)
         input->gpio = gpio;
         input->bit = bit;
         input->inverted = inverted;
-        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, input->gpio, input->bit, false);
     }
     return input;
 };
 
 bool DigitalInputGetState(digital_input_t input){
- return Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, input->gpio, input->bit);
+    return input->debounced ? input->stable : PinRead(input->gpio, input->bit);
+};
+
+bool DigitalInputGetRawState(digital_input_t input){
+    return PinRead(input->gpio, input->bit);
 };
 
 bool DigitalInputHasChanged(digital_input_t input){
@@ -197,6 +222,42 @@ bool DigitalInputHasDeactivated(digital_input_t input){
     input->last_state = current_state;
     return !current_state && last_state;
 };
+
+// Genera un evento en el flanco de activacion y luego repeticiones cada vez mas rapidas
+bool DigitalInputHasRepeated(digital_input_t input, uint32_t now){
+    bool current_state = DigitalInputGetState(input);
+    bool result = false;
+
+    if (current_state && !input->repeat_state){
+        input->repeat_step = 0;
+        input->repeat_next = now + REPEAT_DELAY;
+        result = true;
+    } else if (current_state && ((int32_t)(now - input->repeat_next) >= 0)){
+        input->repeat_next = now + REPEAT_INTERVALS[input->repeat_step];
+        if (input->repeat_step < REPEAT_STEPS - 1){
+            input->repeat_step++;
+        }
+        result = true;
+    }
+    input->repeat_state = current_state;
+    return result;
+};
+
+// Un cambio se acepta cuando todas las muestras de la ventana coinciden, una distinta la reinicia
+void DigitalInputDebounce(digital_input_t input){
+    bool current_state = PinRead(input->gpio, input->bit);
+
+    if (!input->debounced){
+        input->stable = current_state;
+        input->debounce_count = 0;
+        input->debounced = true;
+    } else if (current_state == input->stable){
+        input->debounce_count = 0;
+    } else if (++input->debounce_count >= DIGITAL_DEBOUNCE_SAMPLES){
+        input->stable = current_state;
+        input->debounce_count = 0;
+    }
+};
 /* === Ciere de documentacion ============================================== */
 
 /** @} Final de la definición del modulo para doxygen */
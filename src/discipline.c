@@ -0,0 +1,226 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file discipline.c
+ **
+ ** @brief Disciplina de la hora contra una referencia externa
+ **
+ ** Estimacion del desfase y de la frecuencia del reloj local y correccion sin saltos
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup discipline Disciplina
+ ** @brief Correccion de la hora sin saltos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "discipline.h"
+#include <chip.h>
+#include <stdbool.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Desfase en segundos a partir del cual la hora se ajusta de golpe en lugar de corregirse de a poco
+#ifndef DISCIPLINE_STEP_LIMIT
+    #define DISCIPLINE_STEP_LIMIT 2
+#endif
+
+// Segundos que se acumula la deriva entre pulsos antes de corregir la frecuencia
+#ifndef DISCIPLINE_INTERVAL
+    #define DISCIPLINE_INTERVAL 64
+#endif
+
+// Fraccion de la frecuencia medida que se aplica en cada correccion, suaviza el ruido de un tick de las muestras
+#ifndef DISCIPLINE_GAIN
+    #define DISCIPLINE_GAIN 2
+#endif
+
+// Correccion de frecuencia maxima en partes por millon, un cristal sano esta muy por debajo
+#ifndef DISCIPLINE_MAX_PPM
+    #define DISCIPLINE_MAX_PPM 500
+#endif
+
+#define PPM 1000000LL
+
+#define SECONDS_PER_DAY 86400UL
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+struct discipline_s {
+    clock_t clock;
+    uint16_t ticks_per_second;
+    bool locked;                //!< Hay un pulso previo desde el cual se mide la deriva
+    uint32_t since;             //!< Hora local del comienzo del intervalo de medicion de frecuencia
+    int32_t drift;              //!< Deriva acumulada en ticks durante el intervalo
+    struct discipline_status_s status;
+};
+
+/* === Definiciones de variables privadas ================================== */
+
+static struct discipline_s instances;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static uint32_t Elapsed(discipline_t discipline, uint32_t from, uint32_t to);
+
+static void Correct(discipline_t discipline, int32_t offset, discipline_sample_t const sample);
+
+/* === Definiciones de funciones privadas ================================== */
+
+// Ticks transcurridos entre dos horas locales, teniendo en cuenta el paso por la medianoche
+static uint32_t Elapsed(discipline_t discipline, uint32_t from, uint32_t to){
+    uint32_t day = SECONDS_PER_DAY * discipline->ticks_per_second;
+
+    return (to + day - from) % day;
+}
+
+/*
+ * La parte del desfase que la correccion en curso ya iba a compensar no es error nuevo,
+ * lo que resta es la deriva desde la referencia anterior y se suma a la correccion
+ */
+static void Correct(discipline_t discipline, int32_t offset, discipline_sample_t const sample){
+    int32_t error = offset - sample->slew;
+    uint32_t interval;
+
+    discipline->status.offset = offset;
+    discipline->status.updates++;
+    ClockSlew(discipline->clock, error);
+
+    if (!discipline->locked){
+        discipline->locked = true;
+        discipline->since = sample->ticks;
+        discipline->drift = 0;
+        return;
+    }
+
+    discipline->drift += error;
+    interval = Elapsed(discipline, discipline->since, sample->ticks);
+    if (interval >= DISCIPLINE_INTERVAL * discipline->ticks_per_second){
+        int32_t frequency = discipline->status.frequency;
+
+        frequency += (int32_t)(discipline->drift * PPM / interval) / DISCIPLINE_GAIN;
+        if (frequency > DISCIPLINE_MAX_PPM) frequency = DISCIPLINE_MAX_PPM;
+        if (frequency < -DISCIPLINE_MAX_PPM) frequency = -DISCIPLINE_MAX_PPM;
+
+        discipline->status.frequency = frequency;
+        ClockTrim(discipline->clock, frequency);
+        discipline->since = sample->ticks;
+        discipline->drift = 0;
+    }
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+discipline_t DisciplineCreate(clock_t clock, uint16_t ticks_per_second){
+    discipline_t discipline = &instances;
+
+    discipline->clock = clock;
+    discipline->ticks_per_second = ticks_per_second;
+    discipline->locked = false;
+    discipline->status.offset = 0;
+    discipline->status.frequency = 0;
+    discipline->status.updates = 0;
+    discipline->status.steps = 0;
+    ClockTrim(clock, 0);
+
+    return discipline;
+}
+
+void DisciplineCapture(discipline_t discipline, discipline_sample_t sample){
+    sample->ticks = ClockGetTicks(discipline->clock);
+    sample->slew = ClockGetSlew(discipline->clock);
+}
+
+void DisciplineReference(discipline_t discipline, uint32_t seconds, discipline_sample_t const sample){
+    uint32_t day = SECONDS_PER_DAY * discipline->ticks_per_second;
+    uint32_t reference = (seconds % SECONDS_PER_DAY) * discipline->ticks_per_second;
+    int32_t offset = (int32_t) Elapsed(discipline, sample->ticks, reference);
+    uint8_t time[6];
+
+    if (offset > (int32_t)(day / 2)) offset -= (int32_t) day;
+
+    if (!ClockGetTime(discipline->clock, time, sizeof(time)) ||
+        (offset > DISCIPLINE_STEP_LIMIT * discipline->ticks_per_second) ||
+        (offset < -DISCIPLINE_STEP_LIMIT * discipline->ticks_per_second)){
+        /*
+         * Se suma lo que avanzo el reloj desde la captura para no perder ese tiempo. La lectura y el
+         * ajuste se hacen sin interrupciones, un tick entre ambos se perderia y ClockSetupTicks no
+         * puede cambiar los campos mientras la interrupcion los esta avanzando
+         */
+        __disable_irq();
+        ClockSetupTicks(discipline->clock, (reference + Elapsed(discipline, sample->ticks, ClockGetTicks(discipline->clock))) % day);
+        __enable_irq();
+        discipline->status.offset = offset;
+        discipline->status.steps++;
+        discipline->locked = false;
+        return;
+    }
+
+    /* La correccion de la consola no es deriva del cristal, la medicion de frecuencia vuelve a empezar */
+    discipline->locked = false;
+    Correct(discipline, offset, sample);
+}
+
+void DisciplinePulse(discipline_t discipline, discipline_sample_t const sample){
+    uint32_t day = SECONDS_PER_DAY * discipline->ticks_per_second;
+    uint16_t phase;
+    uint8_t time[6];
+
+    if (!ClockGetTime(discipline->clock, time, sizeof(time))) return;
+
+    /*
+     * El pulso corresponde al comienzo del segundo mas cercano de la hora local ya corregida,
+     * asi una correccion de la consola en curso no se deshace con el primer pulso
+     */
+    phase = ((sample->ticks + day + sample->slew) % day) % discipline->ticks_per_second;
+    if (phase < discipline->ticks_per_second / 2){
+        Correct(discipline, sample->slew - phase, sample);
+    } else {
+        Correct(discipline, sample->slew + discipline->ticks_per_second - phase, sample);
+    }
+}
+
+void DisciplineGetStatus(discipline_t discipline, discipline_status_t status){
+    *status = discipline->status;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
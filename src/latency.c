@@ -0,0 +1,196 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file latency.c
+ **
+ ** @brief Medicion de la demora entre una tecla y la pantalla
+ **
+ ** Maquina de estados por tecla repartida entre la interrupcion y el lazo principal
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup latency Latencia
+ ** @brief Demora de punta a punta de las teclas
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "latency.h"
+#include <chip.h>
+#include <string.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Fuente de las marcas de tiempo, por defecto el contador de ciclos del DWT igual que la traza
+#ifndef LATENCY_TIMESTAMP
+    #define LATENCY_TIMESTAMP() (DWT->CYCCNT)
+#endif
+
+// Limite superior en microsegundos del primer intervalo del histograma
+#define FIRST_BUCKET_US 1000
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+/*
+ * Cada estado tiene un unico contexto que lo puede abandonar: la interrupcion sale de
+ * LIBRE y de PUBLICADA, el lazo principal sale de PRESIONADA y de ATENDIDA. La unica
+ * excepcion es soltar una tecla que sigue PRESIONADA, que la interrupcion devuelve a LIBRE;
+ * si el lazo principal la atiende justo en ese momento igual mide la pulsacion correcta
+ */
+typedef enum {
+    KEY_IDLE,           //!< Sin medicion en curso
+    KEY_PRESSED,        //!< Se vio el flanco, falta que el lazo principal atienda la tecla
+    KEY_HANDLED,        //!< Atendida, falta publicar el cuadro resultante
+    KEY_COMMITTED,      //!< Publicado, falta que el cuadro llegue a la pantalla
+} key_state_t;
+
+struct latency_key_s {
+    volatile uint8_t state;     //!< Uno de key_state_t
+    bool pressed;               //!< Ultimo estado muestreado del terminal
+    uint8_t mode;               //!< Modo en el que se atendio la tecla
+    uint32_t start;             //!< Marca de tiempo del flanco
+    uint32_t frame;             //!< Cuadro que debe llegar a la pantalla para cerrar la medicion
+};
+
+struct latency_s {
+    struct latency_key_s key[LATENCY_KEYS];
+    struct latency_histogram_s histogram[LATENCY_KEYS][LATENCY_MODES];
+    volatile bool clear;        //!< Pedido de borrado del lazo principal, lo atiende la interrupcion
+};
+
+/* === Definiciones de variables privadas ================================== */
+
+static struct latency_s instances;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static void Accumulate(struct latency_histogram_s * histogram, uint32_t cycles);
+
+/* === Definiciones de funciones privadas ================================== */
+
+static void Accumulate(struct latency_histogram_s * histogram, uint32_t cycles){
+    uint32_t us = cycles / (SystemCoreClock / 1000000);
+    uint8_t bucket = 0;
+
+    for (uint32_t limit = FIRST_BUCKET_US; (us >= limit) && (bucket < LATENCY_BUCKETS - 1); limit <<= 1){
+        bucket++;
+    }
+    histogram->bucket[bucket]++;
+    histogram->count++;
+    histogram->total += us;
+    if (us > histogram->max) histogram->max = us;
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+latency_t LatencyCreate(void){
+    latency_t latency = &instances;
+
+    memset(latency->histogram, 0, sizeof(latency->histogram));
+    latency->clear = false;
+    for (uint8_t index = 0; index < LATENCY_KEYS; index++){
+        latency->key[index].state = KEY_IDLE;
+        latency->key[index].pressed = false;
+    }
+    return latency;
+}
+
+void LatencySample(latency_t latency, uint8_t key, bool state){
+    struct latency_key_s * measure = &latency->key[key];
+
+    if (state && !measure->pressed && (measure->state == KEY_IDLE)){
+        measure->start = LATENCY_TIMESTAMP();
+        measure->state = KEY_PRESSED;
+    } else if (!state && measure->pressed && (measure->state == KEY_PRESSED)){
+        /* Una pulsacion que nunca se atendio no debe quedar abierta hasta la siguiente */
+        measure->state = KEY_IDLE;
+    }
+    measure->pressed = state;
+}
+
+void LatencyHandled(latency_t latency, uint8_t key, uint8_t mode){
+    struct latency_key_s * measure = &latency->key[key];
+
+    /* Las repeticiones de una tecla mantenida no tienen flanco y no se miden */
+    if (measure->state == KEY_PRESSED){
+        measure->mode = mode;
+        measure->state = (mode < LATENCY_MODES) ? KEY_HANDLED : KEY_IDLE;
+    }
+}
+
+void LatencyCommitted(latency_t latency, uint32_t frame){
+    for (uint8_t index = 0; index < LATENCY_KEYS; index++){
+        struct latency_key_s * measure = &latency->key[index];
+
+        if (measure->state == KEY_HANDLED){
+            measure->frame = frame;
+            measure->state = KEY_COMMITTED;
+        }
+    }
+}
+
+void LatencyShown(latency_t latency, uint32_t frame){
+    uint32_t now = LATENCY_TIMESTAMP();
+
+    if (latency->clear){
+        memset(latency->histogram, 0, sizeof(latency->histogram));
+        latency->clear = false;
+    }
+    for (uint8_t index = 0; index < LATENCY_KEYS; index++){
+        struct latency_key_s * measure = &latency->key[index];
+
+        /* La resta con signo admite que el numero de cuadro desborde */
+        if ((measure->state == KEY_COMMITTED) && ((int32_t)(frame - measure->frame) >= 0)){
+            Accumulate(&latency->histogram[index][measure->mode], now - measure->start);
+            measure->state = KEY_IDLE;
+        }
+    }
+}
+
+latency_histogram_t LatencyGetHistogram(latency_t latency, uint8_t key, uint8_t mode){
+    return &latency->histogram[key][mode];
+}
+
+void LatencyClear(latency_t latency){
+    latency->clear = true;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
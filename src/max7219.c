@@ -0,0 +1,134 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file max7219.c
+ **
+ ** @brief Controladores de pantalla MAX7219
+ **
+ ** Arma las palabras de configuracion, de digito y de intensidad y guarda una copia de los
+ ** registros de digito para enviar solo los que cambian. La placa y el host comparten este
+ ** archivo y cada uno entrega su propia funcion de envio.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup max7219 Controlador de pantalla
+ ** @brief Controlador MAX7219
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "max7219.h"
+#include "screen.h"
+
+/* === Definicion y Macros privados ======================================== */
+
+// Palabras de configuracion que envia Max7219Clear antes de los registros de digito
+#define SETUP_WORDS 5
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+struct max7219_s {
+    uint8_t digits;
+    max7219_send_t send;
+    uint8_t registers[MAX7219_DIGITS];  //!< Copia de los registros de digito del controlador
+};
+
+/* === Definiciones de variables privadas ================================== */
+
+static struct max7219_s instances;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+/* === Definiciones de funciones privadas ================================== */
+
+/* === Definiciones de funciones publicas ================================== */
+
+max7219_t Max7219Create(uint8_t digits, max7219_send_t send){
+    max7219_t controller = &instances;
+
+    controller->digits = (digits < MAX7219_DIGITS) ? digits : MAX7219_DIGITS;
+    controller->send = send;
+    return controller;
+}
+
+void Max7219Clear(max7219_t controller){
+    uint16_t words[SETUP_WORDS + MAX7219_DIGITS] = {
+        MAX7219_WORD(MAX7219_DISPLAY_TEST, 0),
+        MAX7219_WORD(MAX7219_DECODE_MODE, 0),
+        MAX7219_WORD(MAX7219_SCAN_LIMIT, controller->digits - 1),
+        MAX7219_WORD(MAX7219_INTENSITY, 0x08),
+        MAX7219_WORD(MAX7219_SHUTDOWN, 1),
+    };
+
+    for (uint8_t digit = 0; digit < controller->digits; digit++){
+        words[SETUP_WORDS + digit] = MAX7219_WORD(MAX7219_DIGIT(digit), 0);
+        controller->registers[digit] = 0;
+    }
+    controller->send(words, SETUP_WORDS + controller->digits);
+}
+
+// Arma una sola rafaga con los registros de digito que difieren de la copia
+void Max7219Write(max7219_t controller, uint8_t const * segments, uint8_t digits){
+    uint16_t words[MAX7219_DIGITS];
+    uint8_t count = 0;
+
+    if (digits > controller->digits) digits = controller->digits;
+    for (uint8_t digit = 0; digit < digits; digit++){
+        uint8_t data = 0;
+
+        for (uint8_t segment = 0; segment < 8; segment++){
+            if (segments[digit] & (1 << segment)) data |= MAX7219_SEGMENT_BIT(segment);
+        }
+        if (data != controller->registers[digit]){
+            controller->registers[digit] = data;
+            words[count++] = MAX7219_WORD(MAX7219_DIGIT(digit), data);
+        }
+    }
+    controller->send(words, count);
+}
+
+void Max7219SetBrightness(max7219_t controller, uint8_t level){
+    uint16_t word = MAX7219_WORD(MAX7219_INTENSITY, level * 16 / DISPLAY_BRIGHTNESS_LEVELS);
+
+    controller->send(&word, 1);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,159 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file pin.c
+ **
+ ** @brief Tabla de terminales de la placa
+ **
+ ** Todos los terminales que usa la placa con su funcion y su modo electrico. La placa y
+ ** el host configuran la misma tabla, el host sobre el modelo de registros de chip.h.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup pin Terminales
+ ** @brief Acceso directo a terminales
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "pin.h"
+#include "ciaa.h"
+#include "poncho.h"
+
+/* === Definicion y Macros privados ======================================== */
+
+// Puertos GPIO del LPC4337
+#define GPIO_PORTS 8
+
+#define ELEMENTS(array) (sizeof(array) / sizeof(array[0]))
+
+// Entradas de la tabla de terminales, armadas con las definiciones de ciaa.h y poncho.h
+#define PIN_OUTPUT(name) \
+    {name##_PORT, name##_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | name##_FUNC, PIN_GPIO_OUTPUT, name##_GPIO, name##_BIT}
+
+#define PIN_KEY(name) \
+    {name##_PORT, name##_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | name##_FUNC, PIN_GPIO_INPUT, name##_GPIO, name##_BIT}
+
+#define PIN_INPUT(name) \
+    {name##_PORT, name##_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | name##_FUNC, PIN_GPIO_INPUT, name##_GPIO, name##_BIT}
+
+#define PIN_FUNCTION(name, mode) {name##_PORT, name##_PIN, (mode), PIN_PERIPHERAL, 0, 0}
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+// Uso de un terminal, los conectados a un periferico no tocan los registros de GPIO
+typedef enum {
+    PIN_PERIPHERAL,
+    PIN_GPIO_INPUT,
+    PIN_GPIO_OUTPUT,
+} pin_use_t;
+
+// Configuracion de un terminal de la placa
+struct board_pin_s {
+    uint8_t port;       //!< Puerto del SCU
+    uint8_t pin;        //!< Terminal dentro del puerto del SCU
+    uint16_t mode;      //!< Funcion y modo electrico en el SCU
+    uint8_t use;        //!< Uso del terminal, uno de pin_use_t
+    uint8_t gpio;       //!< Puerto GPIO si el terminal es una entrada o salida digital
+    uint8_t bit;        //!< Bit dentro del puerto GPIO
+};
+
+/* === Definiciones de variables privadas ================================== */
+
+// Todos los terminales usados por la placa, un cambio de placa es un cambio en esta tabla
+static const struct board_pin_s PINS[] = {
+    PIN_OUTPUT(DIGIT_1), PIN_OUTPUT(DIGIT_2), PIN_OUTPUT(DIGIT_3), PIN_OUTPUT(DIGIT_4),
+    PIN_OUTPUT(SEGMENT_A), PIN_OUTPUT(SEGMENT_B), PIN_OUTPUT(SEGMENT_C), PIN_OUTPUT(SEGMENT_D),
+    PIN_OUTPUT(SEGMENT_E), PIN_OUTPUT(SEGMENT_F), PIN_OUTPUT(SEGMENT_G), PIN_OUTPUT(SEGMENT_P),
+    PIN_KEY(TEC_F1), PIN_KEY(TEC_F2), PIN_KEY(TEC_F3), PIN_KEY(TEC_F4), PIN_KEY(TEC_ACCEPT), PIN_KEY(TEC_CANCEL),
+    PIN_INPUT(PPS),
+    PIN_OUTPUT(LED_R), PIN_OUTPUT(LED_G), PIN_OUTPUT(LED_B), PIN_OUTPUT(LED_1), PIN_OUTPUT(LED_2), PIN_OUTPUT(LED_3),
+    PIN_FUNCTION(BUZZER, SCU_MODE_INACT | BUZZER_PWM_FUNC),
+    PIN_FUNCTION(UART_USB_TXD, SCU_MODE_INACT | UART_USB_TXD_FUNC),
+    PIN_FUNCTION(UART_USB_RXD, SCU_MODE_INACT | SCU_MODE_INBUFF_EN | SCU_MODE_ZIF_DIS | UART_USB_RXD_FUNC),
+#ifdef SHIFT_DISPLAY_DIGITS
+    PIN_FUNCTION(SPI_MOSI, SCU_MODE_INACT | SPI_MOSI_FUNC),
+    PIN_FUNCTION(SPI_SCK, SCU_MODE_INACT | SCU_MODE_INBUFF_EN | SPI_SCK_FUNC),
+    PIN_OUTPUT(SHIFT_LATCH),
+    PIN_OUTPUT(SHIFT_BLANK),
+#endif
+#ifdef MAX7219_DISPLAY_DIGITS
+    PIN_FUNCTION(SPI_MOSI, SCU_MODE_INACT | SPI_MOSI_FUNC),
+    PIN_FUNCTION(SPI_SCK, SCU_MODE_INACT | SCU_MODE_INBUFF_EN | SPI_SCK_FUNC),
+    PIN_FUNCTION(SPI_SSEL, SCU_MODE_INACT | SPI_SSEL_FUNC),
+#endif
+};
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+/* === Definiciones de funciones privadas ================================== */
+
+/* === Definiciones de funciones publicas ================================== */
+
+// Configura todos los terminales de la tabla, con una sola escritura de estado y de direccion por puerto
+void PinsInit(void){
+    uint32_t outputs[GPIO_PORTS] = {0};
+    uint32_t inputs[GPIO_PORTS] = {0};
+
+    for (uint8_t index = 0; index < ELEMENTS(PINS); index++){
+        const struct board_pin_s * pin = &PINS[index];
+
+        Chip_SCU_PinMuxSet(pin->port, pin->pin, pin->mode);
+        if (pin->use == PIN_GPIO_OUTPUT){
+            outputs[pin->gpio] |= 1UL << pin->bit;
+        } else if (pin->use == PIN_GPIO_INPUT){
+            inputs[pin->gpio] |= 1UL << pin->bit;
+        }
+    }
+
+    /* Las salidas se apagan antes de habilitarlas para que no aparezcan encendidas durante el arranque */
+    for (uint8_t port = 0; port < GPIO_PORTS; port++){
+        if (outputs[port]){
+            Chip_GPIO_ClearValue(LPC_GPIO_PORT, port, outputs[port]);
+            Chip_GPIO_SetPortDIR(LPC_GPIO_PORT, port, outputs[port], true);
+        }
+        if (inputs[port]){
+            Chip_GPIO_SetPortDIR(LPC_GPIO_PORT, port, inputs[port], false);
+        }
+    }
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,153 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file record.c
+ **
+ ** @brief Grabacion de sesiones de uso para reproducirlas en el host
+ **
+ ** Buffer de registros codificados con la diferencia de ticks respecto del anterior
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup record Grabacion
+ ** @brief Grabacion de sesiones de uso
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "record.h"
+#include <stddef.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Mayor diferencia de ticks que entra en el campo delta de un registro
+#define MAX_DELTA 0xFFFF
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+/* === Definiciones de variables privadas ================================== */
+
+// Tick del ultimo registro agregado
+static uint32_t last_tick;
+
+// Tramo de vueltas del lazo que se sigue extendiendo, NULL si la proxima vuelta abre uno nuevo
+static record_entry_t * loop_run;
+
+// Tick de la ultima vuelta del lazo grabada
+static uint32_t loop_tick;
+
+/* === Definiciones de variables publicas ================================== */
+
+record_buffer_t RecordBuffer = {
+    .magic = RECORD_MAGIC,
+    .entries = RECORD_ENTRIES,
+    .entry_size = sizeof(record_entry_t),
+};
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static record_entry_t * Append(uint16_t delta, uint8_t kind, uint8_t arg, uint32_t value);
+
+/* === Definiciones de funciones privadas ================================== */
+
+static record_entry_t * Append(uint16_t delta, uint8_t kind, uint8_t arg, uint32_t value){
+    record_entry_t * entry;
+
+    if (RecordBuffer.head >= RECORD_ENTRIES){
+        RecordBuffer.flags |= RECORD_FLAG_FULL;
+        return NULL;
+    }
+    entry = &RecordBuffer.entry[RecordBuffer.head];
+    entry->delta = delta;
+    entry->kind = kind;
+    entry->arg = arg;
+    entry->value = value;
+    RecordBuffer.head++;
+    return entry;
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+void RecordStart(uint16_t rate){
+    RecordBuffer.rate = rate;
+    RecordBuffer.flags = 0;
+    RecordBuffer.head = 0;
+    last_tick = 0;
+    loop_run = NULL;
+    loop_tick = 0;
+}
+
+void RecordEvent(uint32_t tick, record_kind_t kind, uint8_t arg, uint32_t value){
+    uint32_t delta = tick - last_tick;
+    record_entry_t * entry;
+
+    if (RecordBuffer.flags & RECORD_FLAG_FULL) return;
+
+    last_tick = tick;
+    /* Las esperas largas ocupan un registro propio para que el resto siga siendo de ocho bytes */
+    if (delta > MAX_DELTA){
+        Append(0, RECORD_WAIT, 0, delta);
+        delta = 0;
+    }
+    entry = Append(delta, kind, arg, value);
+    if (kind == RECORD_LOOP) loop_run = entry;
+}
+
+void RecordLoop(uint32_t tick){
+    uint32_t period = tick - loop_tick;
+
+    /* Con el buffer lleno el tramo no se extiende, la reproduccion termina en el ultimo registro */
+    if (RecordBuffer.flags & RECORD_FLAG_FULL) return;
+
+    /* Varias vueltas dentro del mismo tick se reproducen como una sola */
+    if ((loop_run != NULL) && (period == 0)) return;
+
+    loop_tick = tick;
+    if ((loop_run != NULL) && (loop_run->value == 1) && (period <= UINT8_MAX)){
+        /* La segunda vuelta fija el periodo del tramo */
+        loop_run->arg = period;
+        loop_run->value = 2;
+    } else if ((loop_run != NULL) && (loop_run->arg == period)){
+        loop_run->value++;
+    } else {
+        RecordEvent(tick, RECORD_LOOP, 0, 1);
+    }
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
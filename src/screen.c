@@ -53,24 +53,75 @@
 /* === Inclusiones de cabeceras ============================================ */
 
 #include "screen.h"
+#include <stdbool.h>
 #include <string.h>
 
 /* === Definicion y Macros privados ======================================== */
 
 #ifndef DISPLAY_MAX_DIGITS
-    #define DISPLAY_MAX_DIGITS 8
+    #define DISPLAY_MAX_DIGITS 32
 #endif
 
+// Todos los segmentos de un digito, incluido el punto
+#define ALL_SEGMENTS 0xFF
+
+// Segmentos que forman cada numero
+#define DIGIT_0 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define DIGIT_1 (SEGMENT_B | SEGMENT_C)
+#define DIGIT_2 (SEGMENT_A | SEGMENT_B | SEGMENT_G | SEGMENT_E | SEGMENT_D)
+#define DIGIT_3 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G)
+#define DIGIT_4 (SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G)
+#define DIGIT_5 (SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G)
+#define DIGIT_6 (SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define DIGIT_7 (SEGMENT_A | SEGMENT_B | SEGMENT_C)
+#define DIGIT_8 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define DIGIT_9 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G)
+
+// Arma la tabla de pares de digitos a partir de los segmentos de cada numero
+#define PAIR(tens, units) ((uint16_t)((DIGIT_##tens << 8) | DIGIT_##units))
+#define PAIRS_ROW(tens) PAIR(tens, 0), PAIR(tens, 1), PAIR(tens, 2), PAIR(tens, 3), PAIR(tens, 4), \
+    PAIR(tens, 5), PAIR(tens, 6), PAIR(tens, 7), PAIR(tens, 8), PAIR(tens, 9)
+
 /* === Declaraciones de tipos de datos privados ============================ */
 
+// Grupo de segmentos que parpadean juntos con un mismo periodo, se compone junto con el cuadro
+struct display_blink_s {
+    uint16_t half_period;               //!< Ticks de parpadeo en cada fase, cero si el grupo esta inactivo
+    uint8_t restart;                    //!< Cambia en cada configuracion para que la fase vuelva a empezar
+    uint8_t mask[DISPLAY_MAX_DIGITS];   //!< Segmentos de cada digito que pertenecen al grupo
+};
+
+// Fase de un grupo de parpadeo, solo la modifica la interrupcion
+struct display_phase_s {
+    uint16_t count;                     //!< Ticks que faltan para cambiar de fase
+    bool off;                           //!< El grupo esta en la fase apagada
+    uint8_t restart;                    //!< Configuracion del grupo con la que empezo la fase
+};
+
+// Contenido de la pantalla que componen las aplicaciones
+struct display_frame_s {
+    uint8_t glyphs[DISPLAY_MAX_DIGITS];     //!< Capa de digitos, segmentos de la A a la G
+    uint8_t dots[DISPLAY_MAX_DIGITS];       //!< Capa de puntos e indicadores superpuesta a los digitos
+    struct display_blink_s blink[DISPLAY_BLINK_GROUPS];
+    uint32_t sequence;                      //!< Numero de publicacion del cuadro, viaja con el contenido
+};
+
 struct display_s {
     uint8_t digits;
     uint8_t active_digit;
-    uint8_t blinking_from;
-    uint8_t blinking_to;
-    uint16_t blinking_frequency;
-    uint16_t blinking_count;
-    uint8_t memory[DISPLAY_MAX_DIGITS];
+    volatile uint8_t front;                 //!< Cuadro que se muestra, el otro es el que se compone
+    bool modified;                          //!< El cuadro en composicion tiene cambios sin publicar
+    uint32_t shown;                         //!< Numero de publicacion del cuadro usado en el ultimo refresco
+    uint32_t blinking;                      //!< Numero de publicacion del cuadro del que se tomo el parpadeo
+    volatile bool stale;                    //!< Cambio el parpadeo desde la ultima escritura al controlador
+    volatile uint8_t brightness;            //!< Nivel de brillo pedido por la aplicacion
+    uint8_t applied;                        //!< Nivel de brillo entregado al controlador
+    uint8_t dim_count;                      //!< Llamadas a DisplayDimTick desde el ultimo cambio de digito
+    uint8_t dim_slot;                       //!< Llamadas a DisplayDimTick que duro el turno anterior
+    uint8_t dim_on;                         //!< Llamadas del turno actual con el digito encendido
+    struct display_frame_s frame[2];
+    uint8_t visible[DISPLAY_MAX_DIGITS];    //!< Mascara de parpadeo, segmentos visibles en la fase actual
+    struct display_phase_s phase[DISPLAY_BLINK_GROUPS];
     struct display_driver_s driver;
 };
 
@@ -79,24 +130,126 @@ struct display_s {
 static struct display_s instances[1];
 
 static const uint8_t NUMBERS[] = {
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,                      // 0
-    SEGMENT_B | SEGMENT_C,                                                                      // 1
-    SEGMENT_A | SEGMENT_B | SEGMENT_G | SEGMENT_E | SEGMENT_D,                                  // 2
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,                                  // 3
-    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,                                              // 4
-    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,                                  // 5
-    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,                      // 6
-    SEGMENT_A | SEGMENT_B | SEGMENT_C,                                                          // 7
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,          // 8
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G                                   // 9
+    DIGIT_0, DIGIT_1, DIGIT_2, DIGIT_3, DIGIT_4, DIGIT_5, DIGIT_6, DIGIT_7, DIGIT_8, DIGIT_9,
+};
+
+// Segmentos de los numeros del 00 al 99, las decenas en el byte alto y las unidades en el bajo
+static const uint16_t PAIRS[100] = {
+    PAIRS_ROW(0), PAIRS_ROW(1), PAIRS_ROW(2), PAIRS_ROW(3), PAIRS_ROW(4),
+    PAIRS_ROW(5), PAIRS_ROW(6), PAIRS_ROW(7), PAIRS_ROW(8), PAIRS_ROW(9),
 };
 
 /* === Definiciones de variables publicas ================================== */
 
 /* === Declaraciones de funciones privadas ================================= */
 
+static bool RestartBlink(struct display_phase_s * phase, const struct display_blink_s * blink);
+
+static void UpdateVisible(display_t display, const struct display_frame_s * frame);
+
+static void ScanNextDigit(display_t display, const struct display_frame_s * frame);
+
+static void WriteFrame(display_t display, const struct display_frame_s * frame);
+
+static struct display_frame_s * BackFrame(display_t display);
+
+static const struct display_frame_s * FrontFrame(display_t display);
+
+static void WritePair(struct display_frame_s * frame, uint8_t position, uint8_t value);
+
 /* === Definiciones de funciones privadas ================================== */
 
+// Reinicia la fase de un grupo si se configuro de nuevo en el cuadro publicado
+static bool RestartBlink(struct display_phase_s * phase, const struct display_blink_s * blink){
+    if (phase->restart == blink->restart) return false;
+
+    phase->restart = blink->restart;
+    phase->count = blink->half_period;
+    phase->off = false;
+    return true;
+}
+
+// Recalcula la mascara de segmentos visibles, solo se ejecuta cuando algun grupo cambia de fase
+static void UpdateVisible(display_t display, const struct display_frame_s * frame){
+    for (uint8_t digit = 0; digit < display->digits; digit++){
+        uint8_t visible = ALL_SEGMENTS;
+
+        for (uint8_t group = 0; group < DISPLAY_BLINK_GROUPS; group++){
+            if (display->phase[group].off){
+                visible &= ~frame->blink[group].mask[digit];
+            }
+        }
+        display->visible[digit] = visible;
+    }
+    display->stale = true;
+}
+
+// Pasa al digito siguiente de la pantalla multiplexada
+static void ScanNextDigit(display_t display, const struct display_frame_s * frame){
+    uint8_t digit;
+    uint8_t segments;
+
+    if (display->active_digit == display->digits - 1) {
+        digit = 0;
+    } else {
+        digit = display->active_digit + 1;
+    }
+
+    /* Las capas se combinan solo para el digito que se enciende en este refresco */
+    segments = (frame->glyphs[digit] | frame->dots[digit]) & display->visible[digit];
+
+    if (display->driver.ScanDigit) {
+        /* El controlador cambia digito y segmentos a la vez, no hace falta apagar la pantalla antes. Si
+           no pudo enviarlo el turno del digito anterior se alarga y el barrido no saltea ningun digito */
+        if (!display->driver.ScanDigit(digit, segments)) return;
+    } else {
+        display->driver.ScreenTurnOff();
+        display->driver.ScreenTurnOn(segments);
+        display->driver.DigitTurnOn(digit);
+    }
+    display->active_digit = digit;
+
+    /* El turno se mide en llamadas a DisplayDimTick, asi el brillo no depende de las frecuencias elegidas */
+    display->dim_slot = display->dim_count;
+    display->dim_count = 0;
+    display->dim_on = ((display->brightness + 1) * display->dim_slot + DISPLAY_BRIGHTNESS_LEVELS - 1)
+        / DISPLAY_BRIGHTNESS_LEVELS;
+}
+
+// Entrega la pantalla completa a un controlador que multiplexa por su cuenta
+static void WriteFrame(display_t display, const struct display_frame_s * frame){
+    uint8_t segments[DISPLAY_MAX_DIGITS];
+
+    /* Se marca antes de leer la mascara, un cambio de parpadeo durante la lectura se vuelve a enviar */
+    display->stale = false;
+    for (uint8_t digit = 0; digit < display->digits; digit++){
+        segments[digit] = (frame->glyphs[digit] | frame->dots[digit]) & display->visible[digit];
+    }
+    display->driver.WriteFrame(segments, display->digits);
+}
+
+// Devuelve el cuadro en composicion y lo marca como modificado
+static struct display_frame_s * BackFrame(display_t display){
+    display->modified = true;
+    return &display->frame[display->front ^ 1];
+}
+
+// Devuelve el cuadro publicado, las lecturas de su contenido no se adelantan a la del indice
+static const struct display_frame_s * FrontFrame(display_t display){
+    const struct display_frame_s * frame = &display->frame[display->front];
+
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return frame;
+}
+
+// Escribe dos digitos consecutivos con una sola lectura de la tabla de pares
+static void WritePair(struct display_frame_s * frame, uint8_t position, uint8_t value){
+    uint16_t pair = PAIRS[value];
+
+    frame->glyphs[position] = pair >> 8;
+    frame->glyphs[position + 1] = pair & 0xFF;
+}
+
 /* === Definiciones de funciones publicas ================================== */
 
 display_t DisplayCreate(uint8_t digits, display_driver_t driver){
@@ -104,74 +257,221 @@ display_t DisplayCreate(uint8_t digits, display_driver_t driver){
 
     display->digits = digits;
     display->active_digit = digits - 1;
-    display->blinking_from = 0;
-    display->blinking_to = 0;
-    display->blinking_frequency = 0;
-    display->blinking_count = 0;
-    memset(display->memory, 0, sizeof(display->memory));
+    display->front = 0;
+    display->modified = false;
+    display->shown = 0;
+    display->blinking = 0;
+    display->stale = true;
+    display->brightness = DISPLAY_BRIGHTNESS_LEVELS - 1;
+    /* Ningun nivel valido, el primer refresco entrega el brillo a un controlador que lo regula */
+    display->applied = UINT8_MAX;
+    display->dim_count = 0;
+    display->dim_slot = 0;
+    display->dim_on = 0;
+    memset(display->frame, 0, sizeof(display->frame));
+    memset(display->visible, ALL_SEGMENTS, sizeof(display->visible));
+    memset(display->phase, 0, sizeof(display->phase));
     display->driver.ScreenTurnOff = driver->ScreenTurnOff;
     display->driver.ScreenTurnOn = driver->ScreenTurnOn;
     display->driver.DigitTurnOn = driver->DigitTurnOn;
+    display->driver.ScanDigit = driver->ScanDigit;
+    display->driver.WriteFrame = driver->WriteFrame;
+    display->driver.SetBrightness = driver->SetBrightness;
     display->driver.ScreenTurnOff();
 
     return display;
 }
 
 void DisplayWriteBCD( display_t display, uint8_t * number, uint8_t size){
-    memset(display->memory, 0, sizeof(display->memory));
+    struct display_frame_s * frame = BackFrame(display);
+
+    memset(frame->glyphs, 0, sizeof(frame->glyphs));
     for (size_t i = 0; i < size; i++){
         if (i >= display->digits) break;
-        display->memory[i] = NUMBERS[number[i]];
+        frame->glyphs[i] = NUMBERS[number[i]];
     }
     
 }
 
-void DisplayRefresh(display_t display){
-    uint8_t segments;
-    display->driver.ScreenTurnOff();
-    
-    if (display->active_digit == display->digits - 1) {
-            display->active_digit = 0;
-    } else {
-        display->active_digit = display->active_digit + 1;
-    }
+void DisplayWriteNumber(display_t display, uint32_t value){
+    struct display_frame_s * frame = BackFrame(display);
+    uint8_t position = display->digits;
 
-    if( display->active_digit == 0) {
-        display->blinking_count++;
-        if(display->blinking_count >= display->blinking_frequency){
-            display->blinking_count = 0;
-        }
+    /* Se completa de derecha a izquierda, de a dos digitos por cada division */
+    while (position >= 2){
+        position -= 2;
+        WritePair(frame, position, value % 100);
+        value /= 100;
+    }
+    if (position){
+        frame->glyphs[0] = PAIRS[value % 10] & 0xFF;
     }
+}
 
-    segments = display->memory[display->active_digit];
-    if(display->blinking_frequency > 0){
-        if( display->blinking_count >= display->blinking_frequency / 2){
-            if((display->active_digit >= display->blinking_from) && (display->active_digit <= display->blinking_to)){
-                segments = 0;
-            }
+void DisplayWriteTime(display_t display, uint8_t hours, uint8_t minutes){
+    struct display_frame_s * frame = BackFrame(display);
+
+    WritePair(frame, 0, hours % 100);
+    WritePair(frame, 2, minutes % 100);
+}
+
+void DisplayRefresh(display_t display){
+    const struct display_frame_s * frame = FrontFrame(display);
+
+    /* El parpadeo publicado con el cuadro se aplica antes de mostrarlo */
+    if (frame->sequence != display->blinking) {
+        bool changed = false;
+
+        display->blinking = frame->sequence;
+        for (uint8_t group = 0; group < DISPLAY_BLINK_GROUPS; group++){
+            changed |= RestartBlink(&display->phase[group], &frame->blink[group]);
+        }
+        if (changed) {
+            UpdateVisible(display, frame);
         }
     }
 
-    display->driver.ScreenTurnOn(segments);
-    
-    display->driver.DigitTurnOn(display->active_digit);
+    if (display->driver.WriteFrame == NULL) {
+        ScanNextDigit(display, frame);
+    } else if (display->stale || (frame->sequence != display->shown)) {
+        WriteFrame(display, frame);
+    } else if (display->driver.SetBrightness && (display->brightness != display->applied)) {
+        /* El brillo se entrega desde el mismo contexto que el resto de las escrituras al controlador,
+           pero en un refresco sin cuadro para no superar MAX7219_BURST palabras por llamada */
+        display->applied = display->brightness;
+        display->driver.SetBrightness(display->applied);
+    }
 
+    display->shown = frame->sequence;
 }
 
 void DisplayBlinkDigits(display_t display, uint8_t from, uint8_t to, uint16_t frequency) {
-  display->blinking_from = from;
-  display->blinking_to = to;
-  display->blinking_frequency = frequency;
-  display->blinking_count = 0;
+    DisplayBlinkSegments(display, 0, from, to, ALL_SEGMENTS, frequency);
+}
+
+void DisplayBlinkSegments(display_t display, uint8_t group, uint8_t from, uint8_t to, uint8_t segments, uint16_t period) {
+    struct display_blink_s * blink = &BackFrame(display)->blink[group];
+
+    blink->half_period = 0;
+    memset(blink->mask, 0, sizeof(blink->mask));
+    if (period > 0) {
+        for (int index = from; (index <= to) && (index < display->digits); index++){
+            blink->mask[index] = segments;
+        }
+        blink->half_period = (period > 1) ? period >> 1 : 1;
+    }
+    blink->restart++;
+}
+
+void DisplayBlinkTick(display_t display) {
+    const struct display_frame_s * frame = FrontFrame(display);
+    bool changed = false;
+
+    for (uint8_t group = 0; group < DISPLAY_BLINK_GROUPS; group++){
+        struct display_phase_s * phase = &display->phase[group];
+        uint16_t half_period = frame->blink[group].half_period;
+
+        /* Una configuracion publicada que el refresco todavia no tomo empieza su fase en este tick */
+        if (RestartBlink(phase, &frame->blink[group])){
+            changed = true;
+        } else if (half_period && (--phase->count == 0)){
+            phase->count = half_period;
+            phase->off = !phase->off;
+            changed = true;
+        }
+    }
+    if (changed) {
+        UpdateVisible(display, frame);
+    }
 }
 
 void DisplayToggleDots(display_t display, uint8_t from, uint8_t to) {
+    struct display_frame_s * frame = BackFrame(display);
+
     for (int index = from; index <= to; index++){
-        display->memory[index] ^= SEGMENT_P;
+        frame->dots[index] ^= SEGMENT_P;
     }
     
 }
 
+void DisplaySetDots(display_t display, uint8_t from, uint8_t to, bool state) {
+    struct display_frame_s * frame = BackFrame(display);
+
+    for (int index = from; (index <= to) && (index < display->digits); index++){
+        if (state) {
+            frame->dots[index] |= SEGMENT_P;
+        } else {
+            frame->dots[index] &= ~SEGMENT_P;
+        }
+    }
+}
+
+void DisplayCommit(display_t display) {
+    uint8_t back = display->front ^ 1;
+
+    if (display->modified) {
+        display->modified = false;
+        display->frame[back].sequence = display->frame[back ^ 1].sequence + 1;
+        /* El cambio de indice es una unica escritura, el refresco ve el cuadro anterior o el nuevo completo.
+           Las barreras evitan que el compilador o el procesador lleven las escrituras del cuadro nuevo
+           despues del cambio de indice, o la copia siguiente antes de el */
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        display->front = back;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        /* El refresco ya no lee el cuadro anterior, se lo actualiza para seguir componiendo sobre el nuevo */
+        display->frame[back ^ 1] = display->frame[back];
+    }
+}
+
+void DisplayReadFrame(display_t display, uint8_t * segments, uint8_t size) {
+    const struct display_frame_s * frame = &display->frame[display->front];
+
+    for (uint8_t index = 0; (index < size) && (index < display->digits); index++){
+        segments[index] = frame->glyphs[index] | frame->dots[index];
+    }
+}
+
+uint32_t DisplayGetFrame(display_t display) {
+    return display->frame[display->front].sequence;
+}
+
+uint32_t DisplayGetShownFrame(display_t display) {
+    return display->shown;
+}
+
+void DisplaySetBrightness(display_t display, uint8_t level) {
+    if (level >= DISPLAY_BRIGHTNESS_LEVELS) {
+        level = DISPLAY_BRIGHTNESS_LEVELS - 1;
+    }
+    display->brightness = level;
+}
+
+uint8_t DisplayGetBrightness(display_t display) {
+    return display->brightness;
+}
+
+uint16_t DisplayScanRate(display_t display, uint16_t tick_rate) {
+    uint32_t needed = (uint32_t) display->digits * DISPLAY_DIGIT_RATE;
+    uint16_t prescaler = (needed < tick_rate) ? tick_rate / needed : 1;
+
+    /* El ticker solo acepta frecuencias que dividen a la suya */
+    while (tick_rate % prescaler) {
+        prescaler--;
+    }
+    return tick_rate / prescaler;
+}
+
+void DisplayDimTick(display_t display) {
+    if (display->driver.SetBrightness || display->driver.WriteFrame) return;
+    display->dim_count++;
+
+    /* Se apaga una sola vez por turno, el siguiente refresco vuelve a encender el digito. Con
+       ScanDigit el controlador puede mostrar el barrido con atraso, por eso no se barre un digito
+       vacio sino que se usa ScreenTurnOff, que apaga en el acto */
+    if (display->dim_count == display->dim_on + 1) {
+        display->driver.ScreenTurnOff();
+    }
+}
 
 /* === Ciere de documentacion ============================================== */
 
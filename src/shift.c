@@ -0,0 +1,123 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file shift.c
+ **
+ ** @brief Pantallas en cadenas de registros de desplazamiento 74HC595
+ **
+ ** Arma la cadena de cada paso del barrido en una de dos copias, asi la placa puede enviar
+ ** una por DMA mientras se compone la otra.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup shift Cadena de registros
+ ** @brief Cadena de registros 74HC595
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "shift.h"
+#include <string.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+struct shift_s {
+    uint8_t size;       //!< Bytes de la cadena
+    uint8_t back;       //!< Copia en la que se compone el proximo paso
+    struct shift_driver_s driver;
+    uint8_t chain[2][SHIFT_CHAIN_SIZE(SHIFT_MAX_DIGITS)];
+};
+
+/* === Definiciones de variables privadas ================================== */
+
+static struct shift_s instances;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+/* === Definiciones de funciones privadas ================================== */
+
+/* === Definiciones de funciones publicas ================================== */
+
+shift_t ShiftCreate(uint8_t digits, shift_driver_t driver){
+    shift_t shift = &instances;
+
+    if (digits > SHIFT_MAX_DIGITS) digits = SHIFT_MAX_DIGITS;
+    shift->size = SHIFT_CHAIN_SIZE(digits);
+    shift->back = 0;
+    shift->driver = *driver;
+
+    /* Las salidas quedan apagadas hasta el primer barrido, que carga esta cadena vacia */
+    shift->driver.Blank(true);
+    memset(shift->chain, 0, sizeof(shift->chain));
+    shift->driver.Send(shift->chain[shift->back], shift->size);
+    shift->back ^= 1;
+
+    return shift;
+}
+
+/* Una cadena nueva recien se veria en la proxima carga, la habilitacion apaga las salidas en el acto */
+void ShiftBlank(shift_t shift){
+    shift->driver.Blank(true);
+}
+
+/* La cadena enviada en el paso anterior ya termino de desplazarse, se la pasa a las salidas y se
+   empieza a enviar la nueva. La pantalla va un paso atras del barrido, pero digito y segmentos
+   cambian juntos en el mismo flanco de carga */
+bool ShiftScan(shift_t shift, uint8_t digit, uint8_t segments){
+    uint8_t * chain = shift->chain[shift->back];
+
+    /* Cargar una cadena a medio desplazar mezclaria dos digitos */
+    if (shift->driver.Busy()) return false;
+
+    memset(chain, 0, shift->size);
+    chain[shift->size - 2 - digit / 8] = 1 << (digit % 8);
+    chain[shift->size - 1] = segments;
+
+    shift->driver.Latch();
+    shift->driver.Send(chain, shift->size);
+    shift->back ^= 1;
+    shift->driver.Blank(false);
+    return true;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
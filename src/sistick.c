@@ -0,0 +1,127 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file sistick.c
+ **
+ ** @brief Base de tiempo del SysTick con deteccion de ticks perdidos
+ **
+ ** Compara la llegada de cada interrupcion con el contador de ciclos del DWT para contar
+ ** los ticks que se perdieron. La placa y el host compilan el mismo archivo, el host sobre
+ ** los registros modelados en chip.h.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup bsp Placa
+ ** @brief Base de tiempo de la placa
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "chip.h"
+#include "bsp.h"
+
+/* === Definicion y Macros privados ======================================== */
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+/* === Definiciones de variables privadas ================================== */
+
+// Seguimiento del momento en que deberia llegar cada interrupcion del SysTick
+static struct {
+    uint32_t period;        //!< Ciclos del nucleo entre ticks
+    uint32_t deadline;      //!< Valor del contador de ciclos en el que se espera el proximo tick
+    struct sistick_stats_s stats;
+} sistick;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+/* === Definiciones de funciones privadas ================================== */
+
+/* === Definiciones de funciones publicas ================================== */
+
+void SisTick_Init(uint16_t ticks) {
+    /* Desactivamos las interrupciones*/
+    __disable_irq();
+
+    /* Activamos el Systick*/
+    SystemCoreClockUpdate();
+    SysTick_Config(SystemCoreClock/ticks);
+
+    /* El contador de ciclos es la referencia libre para detectar los ticks perdidos */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    sistick.period = SystemCoreClock / ticks;
+    sistick.deadline = DWT->CYCCNT + sistick.period;
+
+    /* Actualizamos la prioridad de la Int. */
+    NVIC_SetPriority(SysTick_IRQn, (1 <<__NVIC_PRIO_BITS) - 1);
+
+    /* Activamos las interrupciones*/
+    __enable_irq();
+}
+
+uint32_t SisTick_Lost(void) {
+    int32_t lateness = DWT->CYCCNT - sistick.deadline;
+    uint32_t lost = 0;
+
+    /* El SysTick arranca antes de tomar la referencia, la primera interrupcion puede llegar adelantada */
+    if (lateness < 0) {
+        lateness = 0;
+    }
+
+    /* Si la interrupcion estuvo bloqueada mas de un periodo el SysTick solo deja una pendiente */
+    if ((uint32_t) lateness >= sistick.period) {
+        lost = lateness / sistick.period;
+        sistick.stats.overruns++;
+        sistick.stats.lost += lost;
+    }
+    if ((uint32_t) lateness > sistick.stats.max_lateness) {
+        sistick.stats.max_lateness = lateness;
+    }
+    sistick.deadline += (lost + 1) * sistick.period;
+    return lost;
+}
+
+void SisTick_GetStats(sistick_stats_t stats) {
+    *stats = sistick.stats;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,206 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file stopwatch.c
+ **
+ ** @brief Cronometro y temporizador
+ **
+ ** Los objetos guardan marcas del contador compartido, el tiempo se calcula al consultarlo
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup stopwatch Cronometro
+ ** @brief Cronometro y temporizador
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "stopwatch.h"
+
+/* === Definicion y Macros privados ======================================== */
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+struct stopwatch_s {
+    volatile uint32_t const * counter;  //!< Contador monotono compartido
+    uint16_t rate;                      //!< Incrementos por segundo del contador
+    bool running;
+    uint32_t start;                     //!< Valor del contador al arrancar
+    uint32_t accumulated;               //!< Incrementos contados antes del ultimo arranque
+};
+
+struct countdown_s {
+    volatile uint32_t const * counter;  //!< Contador monotono compartido
+    uint16_t rate;                      //!< Incrementos por segundo del contador
+    bool running;
+    uint32_t deadline;                  //!< Valor del contador en el que vence, mientras esta corriendo
+    uint32_t remaining;                 //!< Incrementos restantes, mientras esta detenido
+};
+
+/* === Definiciones de variables privadas ================================== */
+
+static struct stopwatch_s stopwatches;
+
+static struct countdown_s countdowns;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+static uint32_t ToMilliseconds(uint32_t counts, uint16_t rate);
+
+static uint32_t FromMilliseconds(uint32_t milliseconds, uint16_t rate);
+
+static uint32_t CountdownLeft(countdown_t countdown);
+
+/* === Definiciones de funciones privadas ================================== */
+
+static uint32_t ToMilliseconds(uint32_t counts, uint16_t rate){
+    return (rate == 1000) ? counts : (uint32_t) ((uint64_t) counts * 1000 / rate);
+}
+
+static uint32_t FromMilliseconds(uint32_t milliseconds, uint16_t rate){
+    return (rate == 1000) ? milliseconds : (uint32_t) ((uint64_t) milliseconds * rate / 1000);
+}
+
+// Incrementos que faltan para el vencimiento, la resta con signo tolera el desborde del contador
+static uint32_t CountdownLeft(countdown_t countdown){
+    int32_t left;
+
+    if (!countdown->running){
+        return countdown->remaining;
+    }
+    left = (int32_t) (countdown->deadline - *countdown->counter);
+    return (left > 0) ? (uint32_t) left : 0;
+}
+
+/* === Definiciones de funciones publicas ================================== */
+
+stopwatch_t StopwatchCreate(volatile uint32_t const * counter, uint16_t rate){
+    stopwatch_t stopwatch = &stopwatches;
+
+    stopwatch->counter = counter;
+    stopwatch->rate = rate;
+    stopwatch->running = false;
+    stopwatch->start = 0;
+    stopwatch->accumulated = 0;
+    return stopwatch;
+}
+
+void StopwatchStart(stopwatch_t stopwatch){
+    if (!stopwatch->running){
+        stopwatch->start = *stopwatch->counter;
+        stopwatch->running = true;
+    }
+}
+
+void StopwatchStop(stopwatch_t stopwatch){
+    if (stopwatch->running){
+        stopwatch->accumulated += *stopwatch->counter - stopwatch->start;
+        stopwatch->running = false;
+    }
+}
+
+void StopwatchReset(stopwatch_t stopwatch){
+    stopwatch->accumulated = 0;
+    stopwatch->start = *stopwatch->counter;
+}
+
+bool StopwatchIsRunning(stopwatch_t stopwatch){
+    return stopwatch->running;
+}
+
+uint32_t StopwatchGetElapsed(stopwatch_t stopwatch){
+    uint32_t counts = stopwatch->accumulated;
+
+    if (stopwatch->running){
+        counts += *stopwatch->counter - stopwatch->start;
+    }
+    return ToMilliseconds(counts, stopwatch->rate);
+}
+
+countdown_t CountdownCreate(volatile uint32_t const * counter, uint16_t rate){
+    countdown_t countdown = &countdowns;
+
+    countdown->counter = counter;
+    countdown->rate = rate;
+    countdown->running = false;
+    countdown->deadline = 0;
+    countdown->remaining = 0;
+    return countdown;
+}
+
+void CountdownSetup(countdown_t countdown, uint32_t duration){
+    countdown->running = false;
+    countdown->remaining = FromMilliseconds(duration, countdown->rate);
+}
+
+void CountdownStart(countdown_t countdown){
+    if (!countdown->running && countdown->remaining){
+        countdown->deadline = *countdown->counter + countdown->remaining;
+        countdown->running = true;
+    }
+}
+
+void CountdownStop(countdown_t countdown){
+    if (countdown->running){
+        countdown->remaining = CountdownLeft(countdown);
+        countdown->running = false;
+    }
+}
+
+bool CountdownIsRunning(countdown_t countdown){
+    return countdown->running;
+}
+
+uint32_t CountdownGetRemaining(countdown_t countdown){
+    return ToMilliseconds(CountdownLeft(countdown), countdown->rate);
+}
+
+bool CountdownHasExpired(countdown_t countdown){
+    bool expired = countdown->running && (CountdownLeft(countdown) == 0);
+
+    if (expired){
+        countdown->running = false;
+        countdown->remaining = 0;
+    }
+    return expired;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
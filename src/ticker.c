@@ -0,0 +1,153 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file ticker.c
+ **
+ ** @brief Despachador de eventos periodicos desde una unica interrupcion
+ **
+ ** Implementacion del despachador con una tabla de divisores precalculados.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup ticker Despachador de ticks
+ ** @brief Despachador de eventos periodicos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "ticker.h"
+#include <stddef.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+// Lugar para los consumidores de la aplicacion y algunos mas, registrar uno de mas falla en TickerAttach
+#ifndef TICKER_CONSUMERS
+    #define TICKER_CONSUMERS 12
+#endif
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+struct ticker_consumer_s {
+    uint16_t prescaler;
+    uint16_t count;
+    ticker_handler_t handler;
+    ticker_catch_up_t catch_up;
+    void * object;
+};
+
+struct ticker_s {
+    uint16_t rate;
+    uint8_t consumers;
+    struct ticker_consumer_s consumer[TICKER_CONSUMERS];
+};
+
+/* === Definiciones de variables privadas ================================== */
+
+static struct ticker_s instances;
+
+/* === Definiciones de variables publicas ================================== */
+
+/* === Declaraciones de funciones privadas ================================= */
+
+/* === Definiciones de funciones privadas ================================== */
+
+/* === Definiciones de funciones publicas ================================== */
+
+ticker_t TickerCreate(uint16_t rate){
+    instances.rate = rate;
+    instances.consumers = 0;
+    return &instances;
+}
+
+bool TickerAttach(ticker_t ticker, uint16_t rate, ticker_handler_t handler, void * object){
+    struct ticker_consumer_s * consumer;
+
+    if ((ticker->consumers >= TICKER_CONSUMERS) || (rate == 0) || (handler == NULL)) return false;
+    if ((rate > ticker->rate) || (ticker->rate % rate != 0)) return false;
+
+    consumer = &ticker->consumer[ticker->consumers];
+    consumer->prescaler = ticker->rate / rate;
+    consumer->count = consumer->prescaler;
+    consumer->handler = handler;
+    consumer->catch_up = NULL;
+    consumer->object = object;
+    ticker->consumers++;
+    return true;
+}
+
+bool TickerAttachCatchUp(ticker_t ticker, uint16_t rate, ticker_handler_t handler, ticker_catch_up_t catch_up, void * object){
+    if (!TickerAttach(ticker, rate, handler, object)) return false;
+
+    ticker->consumer[ticker->consumers - 1].catch_up = catch_up;
+    return true;
+}
+
+void TickerSkip(ticker_t ticker, uint32_t ticks){
+    struct ticker_consumer_s * consumer = ticker->consumer;
+
+    /* Solo se ejecuta cuando se pierden ticks, las divisiones no afectan al despacho normal */
+    for (uint8_t index = ticker->consumers; index > 0; index--, consumer++){
+        uint32_t periods = 0;
+
+        if (ticks >= consumer->count){
+            uint32_t remaining = ticks - consumer->count;
+
+            periods = 1 + remaining / consumer->prescaler;
+            consumer->count = consumer->prescaler - remaining % consumer->prescaler;
+        } else {
+            consumer->count -= ticks;
+        }
+        if (periods && consumer->catch_up){
+            consumer->catch_up(consumer->object, periods);
+        }
+    }
+}
+
+void TickerDispatch(ticker_t ticker){
+    struct ticker_consumer_s * consumer = ticker->consumer;
+
+    for (uint8_t index = ticker->consumers; index > 0; index--, consumer++){
+        if (--consumer->count == 0){
+            consumer->count = consumer->prescaler;
+            consumer->handler(consumer->object);
+        }
+    }
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
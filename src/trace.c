@@ -0,0 +1,119 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file trace.c
+ **
+ ** @brief Registro binario de eventos en memoria RAM
+ **
+ ** Implementacion del buffer circular de eventos. Cada registro toma la marca de
+ ** tiempo del contador de ciclos del nucleo y reserva su posicion con un incremento
+ ** atomico, por lo que se puede llamar tanto desde el lazo principal como desde
+ ** las interrupciones.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2022.08.27 | evolentini  | Version inicial del archivo             |
+ **
+ ** @defgroup trace Registro de eventos
+ ** @brief Registro binario de eventos en RAM
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+
+#include "trace.h"
+#include <chip.h>
+
+/* === Definicion y Macros privados ======================================== */
+
+#if (TRACE_RECORDS & (TRACE_RECORDS - 1)) != 0
+    #error "TRACE_RECORDS debe ser una potencia de dos"
+#endif
+
+// Fuente de las marcas de tiempo, por defecto el contador de ciclos del DWT
+#ifndef TRACE_TIMESTAMP
+    #define TRACE_TIMESTAMP() (DWT->CYCCNT)
+#endif
+
+// Eventos registrados por defecto, el tick se excluye porque llenaria el buffer en pocos milisegundos
+#define TRACE_DEFAULT_FILTER (~TRACE_MASK(TRACE_EVENT_TICK))
+
+/* === Declaraciones de tipos de datos privados ============================ */
+
+/* === Definiciones de variables privadas ================================== */
+
+static uint32_t filter = TRACE_DEFAULT_FILTER;
+
+/* === Definiciones de variables publicas ================================== */
+
+trace_buffer_t TraceBuffer = {
+    .magic = TRACE_MAGIC,
+    .records = TRACE_RECORDS,
+    .record_size = sizeof(trace_record_t),
+};
+
+/* === Declaraciones de funciones privadas ================================= */
+
+/* === Definiciones de funciones privadas ================================== */
+
+/* === Definiciones de funciones publicas ================================== */
+
+void TraceInit(void){
+    SystemCoreClockUpdate();
+    TraceBuffer.frequency = SystemCoreClock;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+void TraceSetFilter(uint32_t mask){
+    filter = mask;
+}
+
+void TraceRecord(trace_event_t event, uint16_t arg){
+    if (filter & TRACE_MASK(event)){
+        uint32_t timestamp = TRACE_TIMESTAMP();
+        uint32_t index = __atomic_fetch_add(&TraceBuffer.head, 1, __ATOMIC_RELAXED) & (TRACE_RECORDS - 1);
+        trace_record_t * record = &TraceBuffer.record[index];
+
+        record->timestamp = timestamp;
+        record->event = event;
+        record->arg = arg;
+    }
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */